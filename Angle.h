@@ -33,6 +33,8 @@
 
 namespace Units {
 
+    template <typename T>
+    using BasicAngle = Unit<0, 0, 0, true, T>;
     using Angle = Unit<0, 0, 0, true>;
     using PhysicalQuantity = Unit<0, 0, 0, true>;
 
@@ -40,15 +42,15 @@ namespace Units {
      * Class representing a dimentionless quantity. It happens to be also able to represent an angle, hence its
      * specialized member functions.
      */
-    template <>
-    class Unit<0, 0, 0, true> : public Unit<0, 0, 0, false> {
-        friend class Unit<0, 0, 0, false>;
+    template <typename T>
+    class Unit<0, 0, 0, true, T> : public Unit<0, 0, 0, false, T> {
+        friend class Unit<0, 0, 0, false, T>;
 
     public:
-        using Unit<0, 0, 0, false>::ValueType;
-        using Type = Unit<0, 0, 0, true>;
+        using typename Unit<0, 0, 0, false, T>::ValueType;
+        using Type = Unit<0, 0, 0, true, T>;
 
-        friend std::ostream &operator<<(std::ostream &s, Type const &v);
+        friend std::ostream &operator<<(std::ostream &s, Angle const &v);
 
         /**
          * Returns a new angle from the value specified in radians.
@@ -74,25 +76,25 @@ namespace Units {
         /**
          * Returns the value of the angle in radians.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toRad() const {
-            return (*this * (2 * M_PI)).value<Rep>();
+            return (*this * (2 * M_PI)).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the angle in degrees.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toDeg() const {
-            return (*this * 360).value<Rep>();
+            return (*this * 360).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the angle in milliradians.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toMilliRad() const {
-            return (*this * 1000 * (2 * M_PI)).value<Rep>();
+            return (*this * 1000 * (2 * M_PI)).template value<Rep, Policy>();
         }
 
         /**
@@ -117,12 +119,12 @@ namespace Units {
         }
 
         // Allows for conversion from a dimensionless value to its scalar counterpart
-        operator UnitBase::ValueType() const {
+        operator ValueType() const {
             return this->value();
         }
 
     private:
-        using Unit<0, 0, 0, false>::Unit;
+        using Unit<0, 0, 0, false, T>::Unit;
     };
 
     namespace UnitsLiterals {
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  AngleUnwrapper.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_AngleUnwrapper_h
+#define Units_AngleUnwrapper_h
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include "Angle.h"
+#include "Batch.h"
+
+namespace Units {
+
+    /**
+     * Stateful operator turning a stream of wrapped angles (e.g. headings in [-π, π[ or [0, 2π[) into a continuous
+     * angle, by assuming that two consecutive angles differ by less than half a turn. Every jump larger than that is
+     * taken as a wrap and compensated with an integral number of turns.
+     * The stream may be processed in chunks of any size: the state is carried from one chunk to the next, and the
+     * result does not depend on the chunking. As Angle stores turns, the compensation is exact, and the chunks are
+     * processed with the SIMD instruction sets of the batch operations (see Batch.h).
+     * The unwrapped angles can then be differentiated into AngularSpeed values without spurious spikes.
+     */
+    template <typename T>
+    class BasicAngleUnwrapper {
+        static_assert(std::is_floating_point<T>::value, "Unwrapping needs a floating-point representation.");
+
+    public:
+        using AngleType = BasicAngle<T>;
+
+        /**
+         * Creates an unwrapper whose first angle is returned unchanged.
+         */
+        constexpr BasicAngleUnwrapper() = default;
+
+        /**
+         * Unwraps a single angle.
+         */
+        AngleType unwrap(AngleType const &wrapped) {
+            T const value = wrapped.toValue();
+            T unwrapped;
+            this->unwrap(&value, &unwrapped, 1);
+            return AngleType::makeFromValue(unwrapped);
+        }
+
+        /**
+         * Unwraps the next chunk of the stream, and stores it into a span of the same size. The unwrapping can be done
+         * in place, with the same span as input and output, but the spans must not partially overlap.
+         */
+        template <typename Q1, typename Q2>
+        void unwrap(QuantitySpan<Q1> const &wrapped, QuantitySpan<Q2> const &unwrapped) {
+            static_assert(std::is_same<std::remove_const_t<Q1>, AngleType>::value &&
+                              std::is_same<std::remove_const_t<Q2>, AngleType>::value,
+                          "The spans must be spans of angles with the representation of the unwrapper.");
+            static_assert(!std::is_const<Q2>::value, "The output span must be mutable.");
+            assert(wrapped.size() == unwrapped.size());
+            this->unwrap(wrapped.data(), unwrapped.data(), wrapped.size());
+        }
+
+        /**
+         * Returns the last unwrapped angle, or a null angle if nothing has been unwrapped yet.
+         */
+        constexpr AngleType last() const {
+            return AngleType::makeFromValue(_previous + _offset);
+        }
+
+        /**
+         * Returns the integral number of turns added to the last wrapped angle to unwrap it.
+         */
+        constexpr T turns() const {
+            return _offset;
+        }
+
+        /**
+         * Forgets the state, so that the next angle is returned unchanged.
+         */
+        void reset() {
+            *this = BasicAngleUnwrapper();
+        }
+
+    private:
+        void unwrap(T const *wrapped, T *unwrapped, std::size_t size) {
+            if(size == 0) {
+                return;
+            }
+            if(!_started) {
+                _previous = wrapped[0];
+                _started = true;
+            }
+            Batch::detail::runUnwrap(wrapped, unwrapped, size, _previous, _offset);
+        }
+
+        T _previous = 0;
+        T _offset = 0;
+        bool _started = false;
+    };
+
+    using AngleUnwrapper = BasicAngleUnwrapper<UnitBase::ValueType>;
+}
+
+#endif
@@ -0,0 +1,523 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  Batch.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_Batch_h
+#define Units_Batch_h
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "Angle.h"
+#include "QuantitySpan.h"
+
+#if(defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define UNITS_BATCH_X86_DISPATCH
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define UNITS_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define UNITS_ALWAYS_INLINE inline
+#endif
+
+namespace Units {
+    /**
+     * Element-wise arithmetic over spans of quantities.
+     * The dimensions are checked at compile time the same way as with the operators of Unit (e.g. a span of Speed
+     * times a span of Time must be stored into a span of Length), while the loops use the widest SIMD instruction set
+     * supported by the running CPU (SSE2, AVX2 or AVX-512 on x86-64), selected once at run time.
+     * The results are bit-exact with the scalar operators of Unit, as every value goes through the same single IEEE
+     * operation. The output span may be one of the input spans, but must not partially overlap them.
+     */
+    namespace Batch {
+
+        /**
+         * The instruction sets the batch operations are able to use.
+         */
+        enum class InstructionSet { Scalar, Sse2, Avx2, Avx512 };
+
+        namespace detail {
+            enum class Operation { Add, Subtract, Multiply, Divide };
+
+            inline InstructionSet detectInstructionSet() {
+#ifdef UNITS_BATCH_X86_DISPATCH
+                __builtin_cpu_init();
+                if(__builtin_cpu_supports("avx512f")) {
+                    return InstructionSet::Avx512;
+                }
+                if(__builtin_cpu_supports("avx2")) {
+                    return InstructionSet::Avx2;
+                }
+                return InstructionSet::Sse2;
+#else
+                return InstructionSet::Scalar;
+#endif
+            }
+
+            inline std::atomic<InstructionSet> &activeInstructionSet() {
+                static std::atomic<InstructionSet> set{detectInstructionSet()};
+                return set;
+            }
+
+            template <Operation Op, typename R, typename X, typename Y>
+            UNITS_ALWAYS_INLINE void apply(R &r, X const &x, Y const &y) {
+                switch(Op) {
+                    case Operation::Add:
+                        r = x + y;
+                        break;
+                    case Operation::Subtract:
+                        r = x - y;
+                        break;
+                    case Operation::Multiply:
+                        r = x * y;
+                        break;
+                    case Operation::Divide:
+                        r = x / y;
+                        break;
+                }
+            }
+
+            template <Operation Op, bool Broadcast, typename T1, typename T2, typename T3>
+            UNITS_ALWAYS_INLINE void scalarLoop(T1 const *a, T2 const *b, T3 *out, std::size_t begin, std::size_t end) {
+                for(std::size_t i = begin; i < end; ++i) {
+                    apply<Op>(out[i], a[i], b[Broadcast ? 0 : i]);
+                }
+            }
+
+            template <typename T>
+            UNITS_ALWAYS_INLINE void unwrapScalarLoop(T const *in, T *out, std::size_t size, T &previousState, T &offsetState) {
+                T previous = previousState;
+                T offset = offsetState;
+                for(std::size_t i = 0; i < size; ++i) {
+                    T const current = in[i];
+                    offset -= Units::detail::roundToIntegral(current - previous);
+                    previous = current;
+                    out[i] = current + offset;
+                }
+                previousState = previous;
+                offsetState = offset;
+            }
+
+#ifdef UNITS_BATCH_X86_DISPATCH
+            template <typename T, std::size_t Bytes>
+            struct VectorType;
+
+            template <>
+            struct VectorType<float, 16> {
+                typedef float type __attribute__((vector_size(16)));
+            };
+            template <>
+            struct VectorType<float, 32> {
+                typedef float type __attribute__((vector_size(32)));
+            };
+            template <>
+            struct VectorType<float, 64> {
+                typedef float type __attribute__((vector_size(64)));
+            };
+            template <>
+            struct VectorType<double, 16> {
+                typedef double type __attribute__((vector_size(16)));
+            };
+            template <>
+            struct VectorType<double, 32> {
+                typedef double type __attribute__((vector_size(32)));
+            };
+            template <>
+            struct VectorType<double, 64> {
+                typedef double type __attribute__((vector_size(64)));
+            };
+
+            /**
+             * Processes Bytes bytes of values per iteration. Always inlined, so that the vector operations are compiled
+             * for the instruction set of the calling run* function.
+             */
+            template <Operation Op, bool Broadcast, std::size_t Bytes, typename T>
+            UNITS_ALWAYS_INLINE void vectorLoop(T const *a, T const *b, T *out, std::size_t size) {
+                using V = typename VectorType<T, Bytes>::type;
+                constexpr std::size_t width = Bytes / sizeof(T);
+
+                V vb = V{} + b[0];
+                std::size_t i = 0;
+                for(; i + width <= size; i += width) {
+                    V va, vr;
+                    std::memcpy(&va, a + i, Bytes);
+                    if(!Broadcast) {
+                        std::memcpy(&vb, b + i, Bytes);
+                    }
+                    apply<Op>(vr, va, vb);
+                    std::memcpy(out + i, &vr, Bytes);
+                }
+                scalarLoop<Op, Broadcast>(a, b, out, i, size);
+            }
+
+            template <Operation Op, bool Broadcast, typename T>
+            __attribute__((target("sse2"))) void runSse2(T const *a, T const *b, T *out, std::size_t size) {
+                vectorLoop<Op, Broadcast, 16>(a, b, out, size);
+            }
+
+            template <Operation Op, bool Broadcast, typename T>
+            __attribute__((target("avx2"))) void runAvx2(T const *a, T const *b, T *out, std::size_t size) {
+                vectorLoop<Op, Broadcast, 32>(a, b, out, size);
+            }
+
+            template <Operation Op, bool Broadcast, typename T>
+            __attribute__((target("avx512f"))) void runAvx512(T const *a, T const *b, T *out, std::size_t size) {
+                vectorLoop<Op, Broadcast, 64>(a, b, out, size);
+            }
+
+            template <std::size_t Bytes, typename T>
+            UNITS_ALWAYS_INLINE void sincosVectorLoop(T const *x, T *sines, T *cosines, std::size_t size) {
+                using V = typename VectorType<T, Bytes>::type;
+                constexpr std::size_t width = Bytes / sizeof(T);
+
+                std::size_t i = 0;
+                for(; i + width <= size; i += width) {
+                    V vx, vs, vc;
+                    std::memcpy(&vx, x + i, Bytes);
+                    Units::detail::sincosTurns<T>(vx, vs, vc);
+                    std::memcpy(sines + i, &vs, Bytes);
+                    std::memcpy(cosines + i, &vc, Bytes);
+                }
+                for(; i < size; ++i) {
+                    Units::detail::sincosTurns<T>(x[i], sines[i], cosines[i]);
+                }
+            }
+
+            template <typename T>
+            __attribute__((target("sse2"))) void sincosSse2(T const *x, T *sines, T *cosines, std::size_t size) {
+                sincosVectorLoop<16>(x, sines, cosines, size);
+            }
+
+            template <typename T>
+            __attribute__((target("avx2"))) void sincosAvx2(T const *x, T *sines, T *cosines, std::size_t size) {
+                sincosVectorLoop<32>(x, sines, cosines, size);
+            }
+
+            template <typename T>
+            __attribute__((target("avx512f"))) void sincosAvx512(T const *x, T *sines, T *cosines, std::size_t size) {
+                sincosVectorLoop<64>(x, sines, cosines, size);
+            }
+
+            /**
+             * Unwraps size angles, expressed in turns, given the last input angle of the previous chunk and the integral
+             * number of turns added to it, which are both updated.
+             * The angles are processed by blocks small enough to stay in the L1 cache. The jumps between consecutive
+             * inputs of a block are first rounded to integral numbers of turns with vector operations. As they are almost
+             * always null, the whole block then only needs the current offset to be added, otherwise the offset is
+             * accumulated value by value. The inputs of a block are all read before its outputs are written, which makes
+             * in-place unwrapping possible.
+             */
+            template <std::size_t Bytes, typename T>
+            UNITS_ALWAYS_INLINE void unwrapVectorLoop(T const *in, T *out, std::size_t size, T &previousState, T &offsetState) {
+                using V = typename VectorType<T, Bytes>::type;
+                constexpr std::size_t width = Bytes / sizeof(T);
+                constexpr std::size_t block = 256;
+
+                T previous = previousState;
+                T offset = offsetState;
+                T jumps[block];
+                for(std::size_t begin = 0; begin < size; begin += block) {
+                    T const *blockIn = in + begin;
+                    T *blockOut = out + begin;
+                    std::size_t const count = size - begin < block ? size - begin : block;
+
+                    jumps[0] = Units::detail::roundToIntegral(blockIn[0] - previous);
+                    bool wrapped = jumps[0] != 0;
+                    // Sum of the squared jumps, null if no lane has wrapped.
+                    V wrappedLanes{};
+                    std::size_t i = 1;
+                    for(; i + width <= count; i += width) {
+                        V current, shifted, jump;
+                        std::memcpy(&current, blockIn + i, Bytes);
+                        std::memcpy(&shifted, blockIn + i - 1, Bytes);
+                        Units::detail::roundToIntegral<T>(current - shifted, jump);
+                        wrappedLanes += jump * jump;
+                        std::memcpy(jumps + i, &jump, Bytes);
+                    }
+                    for(; i < count; ++i) {
+                        jumps[i] = Units::detail::roundToIntegral(blockIn[i] - blockIn[i - 1]);
+                        wrapped |= jumps[i] != 0;
+                    }
+                    for(std::size_t j = 0; j < width; ++j) {
+                        wrapped |= wrappedLanes[j] != 0;
+                    }
+                    previous = blockIn[count - 1];
+
+                    if(wrapped) {
+                        for(i = 0; i < count; ++i) {
+                            offset -= jumps[i];
+                            blockOut[i] = blockIn[i] + offset;
+                        }
+                    } else {
+                        for(i = 0; i + width <= count; i += width) {
+                            V current;
+                            std::memcpy(&current, blockIn + i, Bytes);
+                            current += offset;
+                            std::memcpy(blockOut + i, &current, Bytes);
+                        }
+                        for(; i < count; ++i) {
+                            blockOut[i] = blockIn[i] + offset;
+                        }
+                    }
+                }
+                previousState = previous;
+                offsetState = offset;
+            }
+
+            template <typename T>
+            __attribute__((target("sse2"))) void unwrapSse2(T const *in, T *out, std::size_t size, T &previous, T &offset) {
+                unwrapVectorLoop<16>(in, out, size, previous, offset);
+            }
+
+            template <typename T>
+            __attribute__((target("avx2"))) void unwrapAvx2(T const *in, T *out, std::size_t size, T &previous, T &offset) {
+                unwrapVectorLoop<32>(in, out, size, previous, offset);
+            }
+
+            template <typename T>
+            __attribute__((target("avx512f"))) void unwrapAvx512(T const *in, T *out, std::size_t size, T &previous, T &offset) {
+                unwrapVectorLoop<64>(in, out, size, previous, offset);
+            }
+#endif
+
+            /**
+             * Generic case: mixed or non floating-point representations go through the scalar loop.
+             */
+            template <Operation Op, bool Broadcast, typename T1, typename T2, typename T3>
+            void run(T1 const *a, T2 const *b, T3 *out, std::size_t size) {
+                scalarLoop<Op, Broadcast>(a, b, out, 0, size);
+            }
+
+            template <Operation Op, bool Broadcast, typename T>
+            std::enable_if_t<std::is_same<T, float>::value || std::is_same<T, double>::value>
+                run(T const *a, T const *b, T *out, std::size_t size) {
+                if(size == 0) {
+                    return;
+                }
+#ifdef UNITS_BATCH_X86_DISPATCH
+                switch(activeInstructionSet().load(std::memory_order_relaxed)) {
+                    case InstructionSet::Avx512:
+                        return runAvx512<Op, Broadcast>(a, b, out, size);
+                    case InstructionSet::Avx2:
+                        return runAvx2<Op, Broadcast>(a, b, out, size);
+                    case InstructionSet::Sse2:
+                        return runSse2<Op, Broadcast>(a, b, out, size);
+                    case InstructionSet::Scalar:
+                        break;
+                }
+#endif
+                scalarLoop<Op, Broadcast>(a, b, out, 0, size);
+            }
+
+            /**
+             * Generic case: long double goes through the scalar loop.
+             */
+            template <typename T, typename R>
+            void runSincos(T const *x, R *sines, R *cosines, std::size_t size) {
+                static_assert(std::is_floating_point<T>::value, "The sine and cosine need a floating-point representation.");
+                for(std::size_t i = 0; i < size; ++i) {
+                    Units::detail::sincosTurns<T>(x[i], sines[i], cosines[i]);
+                }
+            }
+
+            template <typename T>
+            std::enable_if_t<std::is_same<T, float>::value || std::is_same<T, double>::value>
+                runSincos(T const *x, T *sines, T *cosines, std::size_t size) {
+#ifdef UNITS_BATCH_X86_DISPATCH
+                switch(activeInstructionSet().load(std::memory_order_relaxed)) {
+                    case InstructionSet::Avx512:
+                        return sincosAvx512(x, sines, cosines, size);
+                    case InstructionSet::Avx2:
+                        return sincosAvx2(x, sines, cosines, size);
+                    case InstructionSet::Sse2:
+                        return sincosSse2(x, sines, cosines, size);
+                    case InstructionSet::Scalar:
+                        break;
+                }
+#endif
+                for(std::size_t i = 0; i < size; ++i) {
+                    Units::detail::sincosTurns<T>(x[i], sines[i], cosines[i]);
+                }
+            }
+
+            /**
+             * Generic case: long double goes through the scalar loop.
+             */
+            template <typename T, typename R>
+            void runUnwrap(T const *in, R *out, std::size_t size, T &previous, T &offset) {
+                static_assert(std::is_floating_point<T>::value, "Unwrapping needs a floating-point representation.");
+                unwrapScalarLoop(in, out, size, previous, offset);
+            }
+
+            template <typename T>
+            std::enable_if_t<std::is_same<T, float>::value || std::is_same<T, double>::value>
+                runUnwrap(T const *in, T *out, std::size_t size, T &previous, T &offset) {
+#ifdef UNITS_BATCH_X86_DISPATCH
+                switch(activeInstructionSet().load(std::memory_order_relaxed)) {
+                    case InstructionSet::Avx512:
+                        return unwrapAvx512(in, out, size, previous, offset);
+                    case InstructionSet::Avx2:
+                        return unwrapAvx2(in, out, size, previous, offset);
+                    case InstructionSet::Sse2:
+                        return unwrapSse2(in, out, size, previous, offset);
+                    case InstructionSet::Scalar:
+                        break;
+                }
+#endif
+                unwrapScalarLoop(in, out, size, previous, offset);
+            }
+
+            template <typename T>
+            constexpr std::enable_if_t<!is_unit_v<T>, T> rawValue(T const &v) {
+                return v;
+            }
+
+            template <typename T>
+            constexpr std::enable_if_t<is_unit_v<T>, typename T::ValueType> rawValue(T const &v) {
+                return v.toValue();
+            }
+
+            template <Operation Op, typename R, typename Q1, typename Q2, typename Q3>
+            void binary(QuantitySpan<Q1> const &a, QuantitySpan<Q2> const &b, QuantitySpan<Q3> const &out) {
+                static_assert(!std::is_const<Q3>::value, "The output span must be mutable.");
+                static_assert(std::is_same<std::remove_const_t<Q3>, ArrayElementType_t<R>>::value,
+                              "The output span does not have the dimension or representation of the result.");
+                assert(a.size() == out.size() && b.size() == out.size());
+                run<Op, false>(a.data(), b.data(), out.data(), out.size());
+            }
+
+            template <Operation Op, typename R, typename Q1, typename V, typename Q3>
+            void broadcast(QuantitySpan<Q1> const &a, V const &v, QuantitySpan<Q3> const &out) {
+                static_assert(!std::is_const<Q3>::value, "The output span must be mutable.");
+                static_assert(std::is_same<std::remove_const_t<Q3>, ArrayElementType_t<R>>::value,
+                              "The output span does not have the dimension or representation of the result.");
+                assert(a.size() == out.size());
+                auto const raw = static_cast<typename ArrayElementType_t<R>::ValueType>(rawValue(v));
+                run<Op, true>(a.data(), &raw, out.data(), out.size());
+            }
+
+            template <typename V>
+            using EnableIfOperand = std::enable_if_t<is_unit_v<V> || std::is_arithmetic<V>::value>;
+
+            template <typename Q>
+            using Plain = std::remove_const_t<Q>;
+        }
+
+        /**
+         * Returns the instruction set used by the batch operations. It is the best one supported by the running CPU,
+         * unless it has been lowered with setInstructionSet().
+         */
+        inline InstructionSet instructionSet() {
+            return detail::activeInstructionSet().load(std::memory_order_relaxed);
+        }
+
+        /**
+         * Forces the batch operations to use the given instruction set, e.g. to compare the different code paths.
+         * Requesting an instruction set not supported by the CPU selects the best supported one instead.
+         */
+        inline void setInstructionSet(InstructionSet set) {
+            auto const supported = detail::detectInstructionSet();
+            detail::activeInstructionSet().store(set < supported ? set : supported, std::memory_order_relaxed);
+        }
+
+        /**
+         * out[i] = a[i] + b[i]
+         */
+        template <typename Q1, typename Q2, typename Q3>
+        void add(QuantitySpan<Q1> const &a, QuantitySpan<Q2> const &b, QuantitySpan<Q3> const &out) {
+            using R = decltype(std::declval<detail::Plain<Q1>>() + std::declval<detail::Plain<Q2>>());
+            detail::binary<detail::Operation::Add, R>(a, b, out);
+        }
+
+        /**
+         * out[i] = a[i] - b[i]
+         */
+        template <typename Q1, typename Q2, typename Q3>
+        void subtract(QuantitySpan<Q1> const &a, QuantitySpan<Q2> const &b, QuantitySpan<Q3> const &out) {
+            using R = decltype(std::declval<detail::Plain<Q1>>() - std::declval<detail::Plain<Q2>>());
+            detail::binary<detail::Operation::Subtract, R>(a, b, out);
+        }
+
+        /**
+         * out[i] = a[i] * b[i], e.g. a span of Speed times a span of Time into a span of Length.
+         */
+        template <typename Q1, typename Q2, typename Q3>
+        void multiply(QuantitySpan<Q1> const &a, QuantitySpan<Q2> const &b, QuantitySpan<Q3> const &out) {
+            using R = decltype(std::declval<detail::Plain<Q1>>() * std::declval<detail::Plain<Q2>>());
+            detail::binary<detail::Operation::Multiply, R>(a, b, out);
+        }
+
+        /**
+         * out[i] = a[i] / b[i], e.g. a span of Length divided by a span of Time into a span of Speed.
+         */
+        template <typename Q1, typename Q2, typename Q3>
+        void divide(QuantitySpan<Q1> const &a, QuantitySpan<Q2> const &b, QuantitySpan<Q3> const &out) {
+            using R = decltype(std::declval<detail::Plain<Q1>>() / std::declval<detail::Plain<Q2>>());
+            detail::binary<detail::Operation::Divide, R>(a, b, out);
+        }
+
+        /**
+         * out[i] = a[i] * v, where v is a scalar or a quantity.
+         */
+        template <typename Q1, typename V, typename Q3, typename = detail::EnableIfOperand<V>>
+        void multiply(QuantitySpan<Q1> const &a, V const &v, QuantitySpan<Q3> const &out) {
+            using R = decltype(std::declval<detail::Plain<Q1>>() * std::declval<V>());
+            detail::broadcast<detail::Operation::Multiply, R>(a, v, out);
+        }
+
+        /**
+         * out[i] = a[i] / v, where v is a scalar or a quantity.
+         */
+        template <typename Q1, typename V, typename Q3, typename = detail::EnableIfOperand<V>>
+        void divide(QuantitySpan<Q1> const &a, V const &v, QuantitySpan<Q3> const &out) {
+            using R = decltype(std::declval<detail::Plain<Q1>>() / std::declval<V>());
+            detail::broadcast<detail::Operation::Divide, R>(a, v, out);
+        }
+
+        /**
+         * sines[i] = sin(angles[i]) and cosines[i] = cos(angles[i]), for the angles.size() values of the span, computed
+         * together as they share the same range reduction. Angle stores turns, which are reduced exactly, so that the
+         * error does not grow with the magnitude of the angles (see detail::sincosTurns() in math.h for the accuracy).
+         * The results are identical with every instruction set and to those of sinTurns() and cosTurns(), provided that
+         * the polynomials are not contracted into FMA instructions: with GCC, this requires -ffp-contract=off (see
+         * detail::sincosTurns()).
+         */
+        template <typename Q>
+        void sincos(QuantitySpan<Q> const &angles, typename detail::Plain<Q>::ValueType *sines,
+                    typename detail::Plain<Q>::ValueType *cosines) {
+            using T = typename detail::Plain<Q>::ValueType;
+            static_assert(std::is_same<detail::Plain<Q>, BasicAngle<T>>::value, "The span must be a span of angles.");
+            detail::runSincos(angles.data(), sines, cosines, angles.size());
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  BatchTests.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_BatchTests_h
+#define Units_BatchTests_h
+
+/**
+ * Define UNITS_TESTS before including this file to get checkBatch(), a run-time test of the batch operations: unlike
+ * the tests of UnitsTests.h, it depends on the instruction sets of the CPU it runs on.
+ */
+#ifdef UNITS_TESTS
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "Batch.h"
+#include "Length.h"
+#include "Speed.h"
+#include "Time.h"
+#include "math.h"
+
+namespace Units {
+    namespace UnitsTests {
+        namespace detail {
+            template <typename T>
+            bool sameBits(std::vector<T> const &v1, std::vector<T> const &v2) {
+                return v1.size() == v2.size() && std::memcmp(v1.data(), v2.data(), v1.size() * sizeof(T)) == 0;
+            }
+
+            /**
+             * Returns size values spanning many magnitudes and signs, starting with the special values.
+             */
+            template <typename T>
+            std::vector<T> batchTestValues(std::size_t size, std::uint64_t seed) {
+                T const special[] = {T(0), -T(0), T(1), -T(0.5), std::numeric_limits<T>::denorm_min(),
+                                     std::numeric_limits<T>::max(), std::numeric_limits<T>::infinity(),
+                                     std::numeric_limits<T>::quiet_NaN()};
+                std::vector<T> values(size);
+                for(std::size_t i = 0; i < size; ++i) {
+                    seed = seed * 6364136223846793005u + 1442695040888963407u;
+                    T const mantissa = T(seed >> 11) / T(1ull << 53) - T(0.5);
+                    int const exponent = int((seed >> 3) % 40) - 20;
+                    values[i] = (seed % 17 == 0) ? special[(seed >> 7) % 8] : std::ldexp(mantissa, exponent);
+                }
+                return values;
+            }
+
+            /**
+             * Checks the batch operations over size values against the scalar operators of Unit and against
+             * sinTurns() and cosTurns(), with the current instruction set.
+             */
+            template <typename T>
+            bool checkBatch(std::size_t size) {
+                using L = BasicLength<T>;
+                using S = BasicSpeed<T>;
+                using D = BasicTime<T>;
+
+                std::vector<T> const a = batchTestValues<T>(size, 1), b = batchTestValues<T>(size, 2);
+                T const scalar = T(0.3);
+                QuantitySpan<L const> const la(a.data(), size), lb(b.data(), size);
+                QuantitySpan<S const> const sa(a.data(), size);
+                QuantitySpan<D const> const db(b.data(), size);
+                QuantitySpan<BasicAngle<T> const> const angles(a.data(), size);
+
+                std::vector<T> batch(size), scalarResult(size), sines(size), cosines(size), scalarCosines(size);
+                bool ok = true;
+
+                Batch::add(la, lb, QuantitySpan<L>(batch.data(), size));
+                for(std::size_t i = 0; i < size; ++i) {
+                    scalarResult[i] = (la[i] + lb[i]).toValue();
+                }
+                ok = ok && sameBits(batch, scalarResult);
+
+                Batch::subtract(la, lb, QuantitySpan<L>(batch.data(), size));
+                for(std::size_t i = 0; i < size; ++i) {
+                    scalarResult[i] = (la[i] - lb[i]).toValue();
+                }
+                ok = ok && sameBits(batch, scalarResult);
+
+                Batch::multiply(sa, db, QuantitySpan<L>(batch.data(), size));
+                for(std::size_t i = 0; i < size; ++i) {
+                    scalarResult[i] = (sa[i] * db[i]).toValue();
+                }
+                ok = ok && sameBits(batch, scalarResult);
+
+                Batch::divide(la, db, QuantitySpan<S>(batch.data(), size));
+                for(std::size_t i = 0; i < size; ++i) {
+                    scalarResult[i] = (la[i] / db[i]).toValue();
+                }
+                ok = ok && sameBits(batch, scalarResult);
+
+                Batch::multiply(la, scalar, QuantitySpan<L>(batch.data(), size));
+                for(std::size_t i = 0; i < size; ++i) {
+                    scalarResult[i] = (la[i] * scalar).toValue();
+                }
+                ok = ok && sameBits(batch, scalarResult);
+
+                Batch::divide(la, scalar, QuantitySpan<L>(batch.data(), size));
+                for(std::size_t i = 0; i < size; ++i) {
+                    scalarResult[i] = (la[i] / scalar).toValue();
+                }
+                ok = ok && sameBits(batch, scalarResult);
+
+                Batch::sincos(angles, sines.data(), cosines.data());
+                for(std::size_t i = 0; i < size; ++i) {
+                    scalarResult[i] = sinTurns(a[i]);
+                    scalarCosines[i] = cosTurns(a[i]);
+                }
+                return ok && sameBits(sines, scalarResult) && sameBits(cosines, scalarCosines);
+            }
+        }
+
+        /**
+         * Checks that the batch operations, with every instruction set supported by the CPU, give bit-identical results
+         * to the scalar operators, for float and double and for sizes exercising the remainder loops of every vector
+         * width. Restores the current instruction set before returning. With GCC, the sines and cosines only match when
+         * built with -ffp-contract=off (see detail::sincosTurns()).
+         */
+        inline bool checkBatch() {
+            Batch::InstructionSet const current = Batch::instructionSet();
+            bool ok = true;
+            for(Batch::InstructionSet set : {Batch::InstructionSet::Scalar, Batch::InstructionSet::Sse2,
+                                             Batch::InstructionSet::Avx2, Batch::InstructionSet::Avx512}) {
+                Batch::setInstructionSet(set);
+                for(std::size_t size = 0; size <= 67; ++size) {
+                    ok = ok && detail::checkBatch<float>(size) && detail::checkBatch<double>(size);
+                }
+                ok = ok && detail::checkBatch<float>(4099) && detail::checkBatch<double>(4099);
+            }
+            Batch::setInstructionSet(current);
+            return ok;
+        }
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  BinaryAngle.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_BinaryAngle_h
+#define Units_BinaryAngle_h
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <type_traits>
+#include "Angle.h"
+
+namespace Units {
+
+    namespace detail {
+        /**
+         * Sine of a full turn, sampled at 2^Bits + 1 regularly spaced angles so that the last segment can be
+         * interpolated without wrapping the index.
+         */
+        template <int Bits>
+        struct SineTable {
+            static constexpr std::size_t segments = std::size_t(1) << Bits;
+
+            constexpr SineTable() {
+                for(std::size_t i = 0; i <= segments; ++i) {
+                    values[i] = sinTurns(double(i) / segments);
+                }
+            }
+
+            double values[segments + 1] = {};
+        };
+
+        /**
+         * Holds the table as a static member of a class template, so that it is defined once even though this file is
+         * only made of headers.
+         */
+        template <typename = void>
+        struct BinaryAngleTables {
+            static constexpr SineTable<10> sine{};
+        };
+
+        template <typename D>
+        constexpr SineTable<10> BinaryAngleTables<D>::sine;
+    }
+
+    /**
+     * Class representing an angle stored as an unsigned binary fraction of a turn (binary angular measurement): the
+     * raw value 2^N, with N the number of bits of U, is one full turn.
+     * Every angle is thus always normalized in [0, 2π[, and the additions and subtractions wrap around for free through
+     * the unsigned integer overflow. The comparisons are plain integer comparisons on the normalized value, which makes
+     * the type suitable for headings updated at a high rate, in place of Angle::toMod2Pi() and Angle::toMinusPiPi().
+     *
+     * @param U the unsigned integral type of the raw value, usually std::uint32_t (resolution of 2^-32 turn, about
+     * 1.5e-9 rad) or std::uint64_t.
+     */
+    template <typename U>
+    class BasicBinaryAngle {
+        static_assert(std::is_unsigned<U>::value && std::numeric_limits<U>::digits >= 16,
+                      "The raw value of a binary angle must be an unsigned integer of at least 16 bits.");
+
+    public:
+        using ValueType = U;
+        using SignedValueType = std::make_signed_t<U>;
+
+        /**
+         * The number of bits of the raw value.
+         */
+        static constexpr int bits = std::numeric_limits<U>::digits;
+
+        /**
+         * Default constructor, creates a null angle.
+         */
+        constexpr BasicBinaryAngle() = default;
+
+        /**
+         * Returns a new angle from its raw value, expressed in 2^-bits turn.
+         */
+        static constexpr BasicBinaryAngle makeFromValue(ValueType value) {
+            return BasicBinaryAngle(value);
+        }
+
+        /**
+         * Returns a new angle from an Angle, rounded to the nearest multiple of 2^-bits turn. Angles that are already such
+         * a multiple (e.g. those returned by toMod2Pi() or toMinusPiPi()) are converted exactly, whatever their number
+         * of turns. Infinite and NaN angles give a null angle.
+         */
+        template <typename T>
+        static constexpr BasicBinaryAngle makeFromAngle(BasicAngle<T> const &angle) {
+            static_assert(std::is_floating_point<T>::value, "The angle must have a floating-point representation.");
+            // Subtracting the nearest integer is exact, and so is the scaling by a power of 2.
+            return makeFromScaledFraction<T>(fraction<T>(angle.toValue()) * scale<T>());
+        }
+
+        /**
+         * Returns the raw value of the angle, in 2^-bits turn.
+         */
+        constexpr ValueType toValue() const {
+            return _value;
+        }
+
+        /**
+         * Returns the raw value of the angle interpreted as a signed integer, i.e. in 2^-bits turn in [-2^(bits-1),
+         * 2^(bits-1)[ for an angle in [-π, π[.
+         */
+        constexpr SignedValueType toSignedValue() const {
+            return _value > ValueType(std::numeric_limits<SignedValueType>::max())
+                       ? -SignedValueType(ValueType(-_value) - 1) - 1
+                       : SignedValueType(_value);
+        }
+
+        /**
+         * Returns the angle as an Angle in the interval [0, 2π[. The conversion is exact if the representation has at
+         * least bits digits (e.g. a 32-bit binary angle to a double Angle), and rounded to the nearest representable
+         * value otherwise.
+         */
+        template <typename T = UnitBase::ValueType>
+        constexpr BasicAngle<T> toMod2Pi() const {
+            return BasicAngle<T>::makeFromValue(T(_value) / scale<T>());
+        }
+
+        /**
+         * Returns the angle as an Angle in the interval [-π, π[, with the same exactness as toMod2Pi().
+         */
+        template <typename T = UnitBase::ValueType>
+        constexpr BasicAngle<T> toMinusPiPi() const {
+            return BasicAngle<T>::makeFromValue(T(this->toSignedValue()) / scale<T>());
+        }
+
+        constexpr BasicBinaryAngle operator-() const {
+            return BasicBinaryAngle(ValueType(-_value));
+        }
+
+        constexpr BasicBinaryAngle operator+() const {
+            return *this;
+        }
+
+        constexpr BasicBinaryAngle &operator+=(BasicBinaryAngle const &a) {
+            _value += a._value;
+            return *this;
+        }
+
+        constexpr BasicBinaryAngle &operator-=(BasicBinaryAngle const &a) {
+            _value -= a._value;
+            return *this;
+        }
+
+        constexpr BasicBinaryAngle &operator*=(ValueType v) {
+            _value *= v;
+            return *this;
+        }
+
+        constexpr friend BasicBinaryAngle operator+(BasicBinaryAngle const &a1, BasicBinaryAngle const &a2) {
+            return BasicBinaryAngle(ValueType(a1._value + a2._value));
+        }
+
+        /**
+         * Returns the difference between two angles. Its toMinusPiPi() value is the shortest rotation from a2 to a1.
+         */
+        constexpr friend BasicBinaryAngle operator-(BasicBinaryAngle const &a1, BasicBinaryAngle const &a2) {
+            return BasicBinaryAngle(ValueType(a1._value - a2._value));
+        }
+
+        constexpr friend BasicBinaryAngle operator*(BasicBinaryAngle const &a, ValueType v) {
+            return BasicBinaryAngle(ValueType(a._value * v));
+        }
+
+        constexpr friend BasicBinaryAngle operator*(ValueType v, BasicBinaryAngle const &a) {
+            return a * v;
+        }
+
+        constexpr friend bool operator==(BasicBinaryAngle const &a1, BasicBinaryAngle const &a2) {
+            return a1._value == a2._value;
+        }
+
+        constexpr friend bool operator!=(BasicBinaryAngle const &a1, BasicBinaryAngle const &a2) {
+            return !(a1 == a2);
+        }
+
+        /**
+         * Compares two angles normalized in [0, 2π[.
+         */
+        constexpr friend bool operator<(BasicBinaryAngle const &a1, BasicBinaryAngle const &a2) {
+            return a1._value < a2._value;
+        }
+
+        constexpr friend bool operator>(BasicBinaryAngle const &a1, BasicBinaryAngle const &a2) {
+            return a2 < a1;
+        }
+
+        constexpr friend bool operator<=(BasicBinaryAngle const &a1, BasicBinaryAngle const &a2) {
+            return !(a2 < a1);
+        }
+
+        constexpr friend bool operator>=(BasicBinaryAngle const &a1, BasicBinaryAngle const &a2) {
+            return !(a1 < a2);
+        }
+
+        /**
+         * Returns the sine of the angle, linearly interpolated in a table of 1024 values indexed by the 10 most
+         * significant bits. The absolute error is below 5e-6.
+         */
+        constexpr friend double sin(BasicBinaryAngle const &a) {
+            return interpolate(a._value);
+        }
+
+        /**
+         * Returns the cosine of the angle, interpolated the same way as sin().
+         */
+        constexpr friend double cos(BasicBinaryAngle const &a) {
+            return interpolate(ValueType(a._value + (ValueType(1) << (bits - 2))));
+        }
+
+    private:
+        constexpr explicit BasicBinaryAngle(ValueType value) : _value(value) {}
+
+        /**
+         * Returns 2^bits, i.e. one turn in raw units.
+         */
+        template <typename T>
+        static constexpr T scale() {
+            return T(ValueType(1) << (bits - 1)) * 2;
+        }
+
+        /**
+         * Returns the part of turns in [-1/2, 1/2] that is not an integer number of turns, or 0 if turns is infinite or
+         * NaN.
+         */
+        template <typename T>
+        static constexpr T fraction(T turns) {
+            return turns - turns == 0 ? turns - detail::roundToIntegral(turns) : T(0);
+        }
+
+        template <typename T>
+        static constexpr BasicBinaryAngle makeFromScaledFraction(T scaled) {
+            // The scaled fraction is an integer in [-2^(bits-1), 2^(bits-1)], whose conversion to U wraps modulo 2^bits.
+            return detail::roundToIntegral(scaled) >= scale<T>() / 2
+                       ? BasicBinaryAngle(ValueType(ValueType(1) << (bits - 1)))
+                       : BasicBinaryAngle(ValueType(static_cast<SignedValueType>(detail::roundToIntegral(scaled))));
+        }
+
+        static constexpr double interpolate(ValueType value) {
+            constexpr int indexBits = 10;
+            constexpr int fractionBits = bits - indexBits;
+            auto const &table = detail::BinaryAngleTables<>::sine.values;
+
+            std::size_t const index = std::size_t(value >> fractionBits);
+            double const t = double(value & ((ValueType(1) << fractionBits) - 1)) / double(ValueType(1) << fractionBits);
+            return table[index] + (table[index + 1] - table[index]) * t;
+        }
+
+        ValueType _value = 0;
+    };
+
+    using BinaryAngle = BasicBinaryAngle<std::uint32_t>;
+    using BinaryAngle64 = BasicBinaryAngle<std::uint64_t>;
+
+    template <typename U>
+    constexpr int BasicBinaryAngle<U>::bits;
+
+    /**
+     * Prints the angle as its Angle value in [0, 2π[.
+     */
+    template <typename U>
+    std::ostream &operator<<(std::ostream &s, BasicBinaryAngle<U> const &a) {
+        return s << a.toMod2Pi();
+    }
+}
+
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  Bits.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_Bits_h
+#define Units_Bits_h
+
+#include <cstdint>
+
+namespace Units {
+    namespace detail {
+        /**
+         * Returns the index of the most significant bit set in v, which must not be 0.
+         */
+        inline int mostSignificantBit(std::uint64_t v) {
+#ifdef __GNUC__
+            return 63 - __builtin_clzll(v);
+#else
+            int bit = 0;
+            while(v >>= 1) {
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+
+        /**
+         * Returns the index of the least significant bit set in v, which must not be 0.
+         */
+        inline int leastSignificantBit(std::uint64_t v) {
+#ifdef __GNUC__
+            return __builtin_ctzll(v);
+#else
+            int bit = 0;
+            while((v & 1) == 0) {
+                v >>= 1;
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+    }
+}
+
+#endif
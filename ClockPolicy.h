@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  ClockPolicy.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_ClockPolicy_h
+#define Units_ClockPolicy_h
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <limits>
+#include "ExactDuration.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <cpuid.h>
+#define UNITS_HAS_TSC_CLOCK
+#endif
+
+/**
+ * The clock policy of TimePoint, i.e. of BasicTimePoint<ClockPolicy::UNITS_DEFAULT_CLOCK_POLICY>. Defaults to
+ * ClockPolicy::HighResolution, the clock TimePoint has always used. A policy defined in another header, like
+ * Simulated, must be declared before TimePoint.h is included: include SimulatedClock.h first.
+ */
+#ifndef UNITS_DEFAULT_CLOCK_POLICY
+#define UNITS_DEFAULT_CLOCK_POLICY HighResolution
+#endif
+
+namespace Units {
+
+#ifdef UNITS_HAS_TSC_CLOCK
+    namespace detail {
+        // __extension__ keeps -Wpedantic quiet about the non-standard 128-bit integers.
+        __extension__ typedef __int128 Int128;
+        __extension__ typedef unsigned __int128 UInt128;
+    }
+#endif
+
+    /**
+     * The clocks a BasicTimePoint can read. A clock policy provides:
+     * - TimePointType, the representation of a point in time, which must be comparable;
+     * - now(), which reads the clock;
+     * - difference(t1, t2), which returns t1 - t2 as an ExactDuration;
+     * - advance(t, d), which returns t + d for an ExactDuration d;
+     * - optionally sleep(d), which Units::sleep calls instead of std::this_thread::sleep_for (see Simulated).
+     */
+    namespace ClockPolicy {
+
+        /**
+         * Reads a clock of std::chrono, or any class meeting the same Clock requirements.
+         */
+        template <typename C>
+        struct Chrono {
+            using Clock = C;
+            using TimePointType = typename Clock::time_point;
+
+            static TimePointType now() noexcept {
+                return Clock::now();
+            }
+
+            static ExactDuration difference(TimePointType const &t1, TimePointType const &t2) {
+                return ExactDuration::makeFromSystemDelay(t1 - t2);
+            }
+
+            static TimePointType advance(TimePointType const &t, ExactDuration const &d) {
+                return t + std::chrono::duration_cast<typename TimePointType::duration>(d.toSystemDelay());
+            }
+        };
+
+        /**
+         * std::chrono::high_resolution_clock, which is the system clock with libstdc++: it is not monotonic, and
+         * costs a call to the vDSO.
+         */
+        using HighResolution = Chrono<std::chrono::high_resolution_clock>;
+
+        /**
+         * std::chrono::steady_clock, monotonic.
+         */
+        using Steady = Chrono<std::chrono::steady_clock>;
+
+#ifdef CLOCK_MONOTONIC_COARSE
+        /**
+         * The coarse monotonic clock of Linux, which is only updated at each scheduler tick (1 to 4 ms, see
+         * clock_getres()) but is several times cheaper to read than steady_clock.
+         */
+        struct CoarseSteadyClock {
+            using duration = std::chrono::nanoseconds;
+            using rep = duration::rep;
+            using period = duration::period;
+            using time_point = std::chrono::time_point<CoarseSteadyClock>;
+
+            static constexpr bool is_steady = true;
+
+            static time_point now() noexcept {
+                timespec ts;
+                ::clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+                return time_point(duration(rep(ts.tv_sec) * 1000000000 + ts.tv_nsec));
+            }
+        };
+
+        using CoarseSteady = Chrono<CoarseSteadyClock>;
+#endif
+
+#ifdef UNITS_HAS_TSC_CLOCK
+        /**
+         * The time-stamp counter of x86-64 processors, read with a single rdtsc instruction. The points in time are
+         * raw counter values, which are only converted to nanoseconds when a difference is computed, with the ratio
+         * measured against steady_clock by calibrate().
+         * The counter must be invariant (see isInvariant()), i.e. tick at a constant rate in every power state and be
+         * synchronized between the cores, which is the case of the processors of the last decade.
+         */
+        struct Tsc {
+            using TimePointType = std::int64_t;
+
+            /**
+             * The conversion ratios, in 32.32 fixed point.
+             */
+            struct Calibration {
+                std::uint64_t nsPerTick;
+                std::uint64_t ticksPerNs;
+            };
+
+            static TimePointType now() noexcept {
+                return TimePointType(__builtin_ia32_rdtsc());
+            }
+
+            /**
+             * Returns whether the CPU reports an invariant time-stamp counter.
+             */
+            static bool isInvariant() {
+                unsigned eax, ebx, ecx, edx;
+                return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8)) != 0;
+            }
+
+            /**
+             * Returns the conversion ratios, measured on the first call by counting the ticks during 20 ms of
+             * steady_clock. Call it at startup so that the first conversion does not pay for the measurement.
+             */
+            static Calibration const &calibrate() {
+                static Calibration const calibration = measure();
+                return calibration;
+            }
+
+            /**
+             * Returns the frequency of the counter, in ticks per second.
+             */
+            static double frequency() {
+                return double(calibrate().ticksPerNs) * 1e9 / 4294967296.0;
+            }
+
+            static ExactDuration difference(TimePointType const &t1, TimePointType const &t2) {
+                detail::Int128 const ticks = detail::Int128(t1) - t2;
+                return ExactDuration::makeFromNs(clamp(fixedPointProduct(ticks, calibrate().nsPerTick)));
+            }
+
+            static TimePointType advance(TimePointType const &t, ExactDuration const &d) {
+                return clamp(t + fixedPointProduct(d.toNs(), calibrate().ticksPerNs));
+            }
+
+        private:
+            /**
+             * Returns v * ratio, ratio being in 32.32 fixed point, rounded to the nearest integer.
+             */
+            static detail::Int128 fixedPointProduct(detail::Int128 v, std::uint64_t ratio) {
+                return (v * ratio + (detail::Int128(1) << 31)) >> 32;
+            }
+
+            static std::int64_t clamp(detail::Int128 v) {
+                return v > std::numeric_limits<std::int64_t>::max()
+                           ? std::numeric_limits<std::int64_t>::max()
+                           : v < std::numeric_limits<std::int64_t>::min() ? std::numeric_limits<std::int64_t>::min()
+                                                                          : std::int64_t(v);
+            }
+
+            static Calibration measure() {
+                using Clock = std::chrono::steady_clock;
+                auto const start = Clock::now();
+                auto const startTicks = __builtin_ia32_rdtsc();
+                auto end = start;
+                while(end - start < std::chrono::milliseconds(20)) {
+                    end = Clock::now();
+                }
+                auto const ticks = detail::UInt128(__builtin_ia32_rdtsc() - startTicks);
+                auto const ns = detail::UInt128(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+                return Calibration{std::uint64_t((ns << 32) / ticks), std::uint64_t((ticks << 32) / ns)};
+            }
+        };
+#endif
+    }
+}
+
+#endif
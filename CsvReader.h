@@ -0,0 +1,529 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  CsvReader.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_CsvReader_h
+#define Units_CsvReader_h
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Batch.h"
+#include "Parse.h"
+#include "QuantityArray.h"
+#include "Unit.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define UNITS_HAS_MMAP 1
+#endif
+
+namespace Units {
+
+#ifdef UNITS_HAS_MMAP
+    /**
+     * A read-only memory mapping of a whole file (POSIX only). The pages are read by the kernel as they are accessed,
+     * so that opening a file of several gigabytes is immediate and its parsing does not need a copy in a user buffer.
+     */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+
+        MappedFile(MappedFile const &) = delete;
+        MappedFile &operator=(MappedFile const &) = delete;
+
+        MappedFile(MappedFile &&f) noexcept : _data(f._data), _size(f._size) {
+            f._data = nullptr;
+            f._size = 0;
+        }
+
+        MappedFile &operator=(MappedFile &&f) noexcept {
+            std::swap(_data, f._data);
+            std::swap(_size, f._size);
+            return *this;
+        }
+
+        ~MappedFile() {
+            close();
+        }
+
+        /**
+         * Maps the file at the given path, replacing the previous mapping if any. Returns the error of the failing
+         * system call, or an empty error code on success.
+         */
+        std::error_code open(char const *path) {
+            close();
+
+            int const fd = ::open(path, O_RDONLY);
+            if(fd < 0) {
+                return std::error_code(errno, std::generic_category());
+            }
+
+            std::error_code error;
+            struct stat status;
+            if(::fstat(fd, &status) != 0) {
+                error = std::error_code(errno, std::generic_category());
+            } else if(status.st_size > 0) {
+                void *data = ::mmap(nullptr, std::size_t(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if(data == MAP_FAILED) {
+                    error = std::error_code(errno, std::generic_category());
+                } else {
+                    ::madvise(data, std::size_t(status.st_size), MADV_SEQUENTIAL);
+                    _data = static_cast<char const *>(data);
+                    _size = std::size_t(status.st_size);
+                }
+            }
+            ::close(fd);
+            return error;
+        }
+
+        /**
+         * Unmaps the file. The pointers given by data() become invalid.
+         */
+        void close() {
+            if(_data != nullptr) {
+                ::munmap(const_cast<char *>(_data), _size);
+                _data = nullptr;
+                _size = 0;
+            }
+        }
+
+        char const *data() const {
+            return _data;
+        }
+
+        std::size_t size() const {
+            return _size;
+        }
+
+    private:
+        char const *_data = nullptr;
+        std::size_t _size = 0;
+    };
+#endif
+
+    /**
+     * The result of CsvReader::read(): the number of rows read, and on failure the error and the 1-based line of the
+     * file where it occured (line 1 being the header).
+     */
+    struct CsvResult {
+        std::size_t rows;
+        std::size_t line;
+        std::errc ec;
+    };
+
+    /**
+     * Reads the columns of a comma-separated text into arrays of quantities. The first line names the columns with
+     * their unit between brackets, e.g. "t[ms],speed[mm/s],heading[deg]", the unit being one of the symbols accepted by
+     * parse(); the following lines hold one number per column. Blank lines are skipped.
+     * The columns to read are given with bind(), and their unit must have the dimension of the array, e.g. a column
+     * in [ms] can only be read into a QuantityArray<Time>. The other columns are skipped.
+     *
+     * The text is split into chunks of whole lines, which are parsed in parallel: each thread first counts the lines
+     * of its chunk, then parses them in place into the arrays, and finally converts its rows from the unit of the
+     * column in bulk with the batch operations (e.g. a division by 1000 for millimeters, as Length::makeFromMm() does).
+     * The values of the columns narrower than double (float) are instead parsed and converted in double, and rounded
+     * once to the representation, so that every value is the one parse() gives for the same text.
+     * The program must thus be linked with the thread library of the platform (e.g. -pthread).
+     *
+     * Usage:
+     *     MappedFile file;
+     *     file.open("log.csv");
+     *     QuantityArray<Time> t;
+     *     QuantityArray<Speed> speed;
+     *     CsvReader reader(file.data(), file.data() + file.size());
+     *     reader.bind("t", t);
+     *     reader.bind("speed", speed);
+     *     CsvResult result = reader.read();
+     */
+    class CsvReader {
+    public:
+        /**
+         * Creates a reader over the text [first, last[, which must outlive the reader.
+         */
+        CsvReader(char const *first, char const *last) : _first(first), _last(last) {}
+
+#ifdef UNITS_HAS_MMAP
+        explicit CsvReader(MappedFile const &file) : CsvReader(file.data(), file.data() + file.size()) {}
+#endif
+
+        /**
+         * Reads the column of the given name into column, whose previous content is replaced. The array must outlive
+         * the call to read().
+         */
+        template <int Kg, int M, int S, typename T>
+        void bind(char const *name, QuantityArray<Unit<Kg, M, S, true, T>> &column) {
+            using Q = Unit<Kg, M, S, true, T>;
+            static_assert(std::is_floating_point<T>::value,
+                          "The columns are converted from their unit in place, which needs a floating-point representation.");
+            Column c;
+            c.name = name;
+            c.nameLength = std::strlen(name);
+            c.kg = Kg;
+            c.m = M;
+            c.s = S;
+            c.array = &column;
+            c.resize = &resizeColumn<Q>;
+            c.parse = &parseField<T>;
+            c.scale = &scaleRows<Q>;
+            _columns.push_back(c);
+        }
+
+        /**
+         * Reads the bound columns, with the given number of threads (the number of hardware threads by default). The
+         * text is not split into chunks smaller than minChunkSize bytes, so that small files are read by the calling
+         * thread only.
+         * On failure, the content of the arrays is unspecified.
+         */
+        CsvResult read(unsigned threadCount = 0) {
+            if(_first == _last) {
+                // No header (e.g. an empty MappedFile, whose data is null).
+                return _columns.empty() ? CsvResult{0, 0, std::errc()} : CsvResult{0, 1, std::errc::invalid_argument};
+            }
+
+            char const *body = _first;
+            CsvResult header = readHeader(body);
+            if(header.ec != std::errc()) {
+                return header;
+            }
+
+            if(threadCount == 0) {
+                threadCount = std::max(1u, std::thread::hardware_concurrency());
+            }
+            std::size_t const chunkCount =
+                std::max<std::size_t>(1, std::min<std::size_t>(threadCount, std::size_t(_last - body) / minChunkSize));
+
+            std::vector<Chunk> chunks(chunkCount);
+            char const *begin = body;
+            for(std::size_t i = 0; i < chunkCount; ++i) {
+                char const *end = i + 1 == chunkCount ? _last : lineEnd(body + std::size_t(_last - body) * (i + 1) / chunkCount);
+                if(end != _last) {
+                    ++end;
+                }
+                chunks[i].first = begin;
+                chunks[i].last = std::max(begin, end);
+                begin = chunks[i].last;
+            }
+
+            forEachChunk(chunks, [](Chunk &chunk) { countLines(chunk); });
+
+            std::size_t rows = 0, lines = 0;
+            for(auto &chunk : chunks) {
+                chunk.firstRow = rows;
+                chunk.firstLine = lines;
+                rows += chunk.rows;
+                lines += chunk.lines;
+            }
+            for(auto &column : _columns) {
+                column.data = column.resize(column.array, rows);
+            }
+
+            forEachChunk(chunks, [this](Chunk &chunk) { parseChunk(chunk); });
+
+            for(auto const &chunk : chunks) {
+                if(chunk.ec != std::errc()) {
+                    return CsvResult{0, 2 + chunk.firstLine + chunk.errorLine, chunk.ec};
+                }
+            }
+            return CsvResult{rows, 0, std::errc()};
+        }
+
+        /**
+         * The smallest chunk, in bytes, given to a thread.
+         */
+        static constexpr std::size_t minChunkSize = 1 << 20;
+
+    private:
+        struct Column {
+            char const *name;
+            std::size_t nameLength;
+            int kg;
+            int m;
+            int s;
+            void *array;
+            void *(*resize)(void *array, std::size_t size);
+            bool (*parse)(Column const &column, std::size_t row, char const *first, char const *last);
+            void (*scale)(void *data, std::size_t row, std::size_t count, double multiplier, double divisor);
+
+            // Set by readHeader() and read().
+            void *data = nullptr;
+            double multiplier = 1;
+            double divisor = 1;
+            bool found = false;
+        };
+
+        struct Chunk {
+            char const *first = nullptr;
+            char const *last = nullptr;
+            std::size_t lines = 0;
+            std::size_t rows = 0;
+            std::size_t firstLine = 0;
+            std::size_t firstRow = 0;
+            std::size_t errorLine = 0;
+            std::errc ec = std::errc();
+        };
+
+        template <typename Q>
+        static void *resizeColumn(void *array, std::size_t size) {
+            auto &column = *static_cast<QuantityArray<Q> *>(array);
+            column.resize(size);
+            return column.data();
+        }
+
+        /**
+         * Whether the values of a column are converted from its unit by scaleRows() (the representation is at least as
+         * wide as double), or by parseField() (float), which has to convert them before rounding them to T.
+         */
+        template <typename T>
+        using ScaledInBulk = std::is_same<CommonValueType<T, double>, T>;
+
+        /**
+         * Parses a field in the type parse() uses, CommonValueType<T, double>.
+         */
+        template <typename T>
+        static bool parseField(Column const &column, std::size_t row, char const *first, char const *last) {
+            using NumberType = CommonValueType<T, double>;
+            NumberType number;
+            ParseResult const result = detail::parseNumber(first, last, number);
+            if(result.ec != std::errc() || result.ptr != last) {
+                return false;
+            }
+            static_cast<T *>(column.data)[row] =
+                ScaledInBulk<T>::value ? static_cast<T>(number)
+                                       : static_cast<T>(number * NumberType(column.multiplier) / NumberType(column.divisor));
+            return true;
+        }
+
+        /**
+         * Converts the rows from the unit of the column like parse() does, by a multiplication and then a division.
+         */
+        template <typename Q>
+        static void scaleRows(void *data, std::size_t row, std::size_t count, double multiplier, double divisor) {
+            using ValueType = typename Q::ValueType;
+            if(!ScaledInBulk<ValueType>::value) {
+                return;
+            }
+            QuantitySpan<Q> rows(static_cast<ValueType *>(data) + row, count);
+            if(multiplier != 1) {
+                Batch::multiply(rows, static_cast<ValueType>(multiplier), rows);
+            }
+            if(divisor != 1) {
+                Batch::divide(rows, static_cast<ValueType>(divisor), rows);
+            }
+        }
+
+        char const *lineEnd(char const *p) const {
+            auto const end = static_cast<char const *>(std::memchr(p, '\n', std::size_t(_last - p)));
+            return end ? end : _last;
+        }
+
+        /**
+         * Counts the lines of a chunk, and those which are not blank (see isBlank()), i.e. its rows.
+         */
+        static void countLines(Chunk &chunk) {
+            char const *first = chunk.first;
+            while(first != chunk.last) {
+                auto const end = static_cast<char const *>(std::memchr(first, '\n', std::size_t(chunk.last - first)));
+                ++chunk.lines;
+                if(!isBlank(first, end ? end : chunk.last)) {
+                    ++chunk.rows;
+                }
+                if(end == nullptr) {
+                    break;
+                }
+                first = end + 1;
+            }
+        }
+
+        /**
+         * Returns whether a line only holds spaces and carriage returns. Such lines, e.g. the empty line ending many
+         * files, are skipped.
+         */
+        static bool isBlank(char const *first, char const *last) {
+            while(first != last && (*first == ' ' || *first == '\r')) {
+                ++first;
+            }
+            return first == last;
+        }
+
+        /**
+         * Returns the end of the field starting at first, with the surrounding spaces removed from [first, end[.
+         */
+        static char const *fieldEnd(char const *&first, char const *last) {
+            auto end = static_cast<char const *>(std::memchr(first, ',', std::size_t(last - first)));
+            char const *next = end ? end : last;
+            while(first != next && *first == ' ') {
+                ++first;
+            }
+            end = next;
+            while(end != first && end[-1] == ' ') {
+                --end;
+            }
+            return end;
+        }
+
+        static char const *trimLine(char const *first, char const *last) {
+            return last != first && last[-1] == '\r' ? last - 1 : last;
+        }
+
+        /**
+         * Matches the bound columns with the fields of the header line, and moves body past it.
+         */
+        CsvResult readHeader(char const *&body) {
+            char const *end = lineEnd(_first);
+            char const *last = trimLine(_first, end);
+            body = end == _last ? end : end + 1;
+
+            _fieldColumns.clear();
+            for(auto &column : _columns) {
+                column.found = false;
+            }
+
+            for(char const *field = _first; field <= last;) {
+                char const *nameEnd = fieldEnd(field, last);
+                char const *next = nameEnd;
+                while(next != last && *next != ',') {
+                    ++next;
+                }
+
+                char const *unit = static_cast<char const *>(std::memchr(field, '[', std::size_t(nameEnd - field)));
+                char const *name = field;
+                char const *nameLast = unit ? unit : nameEnd;
+                while(nameLast != name && nameLast[-1] == ' ') {
+                    --nameLast;
+                }
+
+                Column *match = nullptr;
+                for(auto &column : _columns) {
+                    if(column.nameLength == std::size_t(nameLast - name) && std::memcmp(column.name, name, column.nameLength) == 0) {
+                        match = &column;
+                    }
+                }
+                _fieldColumns.push_back(match);
+
+                if(match != nullptr) {
+                    match->found = true;
+                    if(unit == nullptr) {
+                        if(match->kg != 0 || match->m != 0 || match->s != 0) {
+                            return CsvResult{0, 1, std::errc::invalid_argument};
+                        }
+                        match->multiplier = match->divisor = 1;
+                    } else {
+                        if(nameEnd[-1] != ']') {
+                            return CsvResult{0, 1, std::errc::invalid_argument};
+                        }
+                        auto const symbol = detail::ParseTables<>::suffixes.find(unit + 1, std::size_t(nameEnd - 1 - (unit + 1)));
+                        if(symbol == nullptr || symbol->kg != match->kg || symbol->m != match->m || symbol->s != match->s) {
+                            return CsvResult{0, 1, std::errc::invalid_argument};
+                        }
+                        match->multiplier = symbol->multiplier;
+                        match->divisor = symbol->divisor;
+                    }
+                }
+                field = next + 1;
+            }
+
+            for(auto const &column : _columns) {
+                if(!column.found) {
+                    return CsvResult{0, 1, std::errc::invalid_argument};
+                }
+            }
+            return CsvResult{0, 0, std::errc()};
+        }
+
+        void parseChunk(Chunk &chunk) const {
+            char const *line = chunk.first;
+            for(std::size_t row = 0, lineIndex = 0; row < chunk.rows; ++lineIndex) {
+                auto const end = static_cast<char const *>(std::memchr(line, '\n', std::size_t(chunk.last - line)));
+                char const *lineLast = trimLine(line, end ? end : chunk.last);
+                if(isBlank(line, lineLast)) {
+                    line = end ? end + 1 : chunk.last;
+                    continue;
+                }
+
+                char const *field = line;
+                for(std::size_t i = 0; i < _fieldColumns.size(); ++i) {
+                    if(field > lineLast) {
+                        chunk.errorLine = lineIndex;
+                        chunk.ec = std::errc::invalid_argument;
+                        return;
+                    }
+                    char const *fieldLast = fieldEnd(field, lineLast);
+                    Column const *column = _fieldColumns[i];
+                    if(column != nullptr && !column->parse(*column, chunk.firstRow + row, field, fieldLast)) {
+                        chunk.errorLine = lineIndex;
+                        chunk.ec = std::errc::invalid_argument;
+                        return;
+                    }
+                    field = fieldLast;
+                    while(field != lineLast && *field != ',') {
+                        ++field;
+                    }
+                    ++field;
+                }
+                line = end ? end + 1 : chunk.last;
+                ++row;
+            }
+
+            for(auto const &column : _columns) {
+                column.scale(column.data, chunk.firstRow, chunk.rows, column.multiplier, column.divisor);
+            }
+        }
+
+        /**
+         * Runs f on every chunk, the first one on the calling thread and the others on their own thread.
+         */
+        template <typename F>
+        static void forEachChunk(std::vector<Chunk> &chunks, F f) {
+            std::vector<std::thread> threads;
+            threads.reserve(chunks.size() - 1);
+            for(std::size_t i = 1; i < chunks.size(); ++i) {
+                threads.emplace_back(f, std::ref(chunks[i]));
+            }
+            f(chunks[0]);
+            for(auto &thread : threads) {
+                thread.join();
+            }
+        }
+
+        char const *_first;
+        char const *_last;
+        std::vector<Column> _columns;
+        std::vector<Column *> _fieldColumns;
+    };
+}
+
+#endif
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  CsvReaderTests.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_CsvReaderTests_h
+#define Units_CsvReaderTests_h
+
+/**
+ * Define UNITS_TESTS before including this file to get checkCsvReader(), a run-time test of CsvReader: it reads texts
+ * built in memory, with several threads.
+ */
+#ifdef UNITS_TESTS
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <system_error>
+#include <vector>
+#include "Angle.h"
+#include "CsvReader.h"
+#include "Length.h"
+#include "Parse.h"
+#include "QuantityArray.h"
+#include "Time.h"
+
+namespace Units {
+    namespace UnitsTests {
+        namespace detail {
+            /**
+             * The columns of csvTestText(): a float column (converted field by field), a double column (converted in
+             * bulk by a division) and an angle column (converted in bulk by a multiplication and a division).
+             */
+            struct CsvTestColumns {
+                QuantityArray<BasicTime<float>> t;
+                QuantityArray<Length> x;
+                QuantityArray<Angle> a;
+            };
+
+            template <typename Q>
+            Q parseCsvTestValue(char const *number, char const *unit) {
+                std::string const text = std::string(number) + unit;
+                Q value;
+                parse(text.data(), text.data() + text.size(), value);
+                return value;
+            }
+
+            /**
+             * Returns a text of rowCount rows, with an ignored column, CRLF line endings and blank lines, and appends
+             * the values parse() gives for its fields to expected. The row of index badRow, if any, has an invalid
+             * field, and badLine receives its 1-based line.
+             */
+            inline std::string csvTestText(std::size_t rowCount, std::size_t badRow, std::size_t &badLine,
+                                           CsvTestColumns &expected) {
+                std::string text = "t[ms], note ,x[mm],a [PI]\n";
+                std::size_t line = 1;
+                std::uint64_t seed = 12345;
+                char t[32], x[32], a[32], row[128];
+                for(std::size_t i = 0; i < rowCount; ++i) {
+                    seed = seed * 6364136223846793005u + 1442695040888963407u;
+                    if(seed % 7 == 0) {
+                        text += seed % 2 ? "\r\n" : "  \n";
+                        ++line;
+                    }
+                    std::snprintf(t, sizeof(t), "%.9g", double(seed >> 11) / double(1ull << 40));
+                    std::snprintf(x, sizeof(x), "%.17g", double(std::int64_t(seed)) / double(1ull << 50));
+                    std::snprintf(a, sizeof(a), "%.17g", double(seed >> 20) / double(1ull << 30));
+                    std::snprintf(row, sizeof(row), "%s,n%u, %s ,%s%s", t, unsigned(i), i == badRow ? "1x" : x, a,
+                                  seed % 3 == 0 ? "\r\n" : "\n");
+                    text += row;
+                    ++line;
+                    if(i == badRow) {
+                        badLine = line;
+                    }
+                    expected.t.push_back(parseCsvTestValue<BasicTime<float>>(t, "ms"));
+                    expected.x.push_back(parseCsvTestValue<Length>(x, "mm"));
+                    expected.a.push_back(parseCsvTestValue<Angle>(a, "PI"));
+                }
+                return text;
+            }
+
+            template <typename Q>
+            bool sameValues(QuantityArray<Q> const &a1, QuantityArray<Q> const &a2) {
+                if(a1.size() != a2.size()) {
+                    return false;
+                }
+                for(std::size_t i = 0; i < a1.size(); ++i) {
+                    if(a1[i].toValue() != a2[i].toValue()) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            template <typename Q>
+            CsvResult readCsvTestColumn(char const *text, char const *name, unsigned threadCount = 1) {
+                QuantityArray<Q> column;
+                CsvReader reader(text, text + std::char_traits<char>::length(text));
+                reader.bind(name, column);
+                return reader.read(threadCount);
+            }
+
+            inline bool sameResult(CsvResult const &r1, CsvResult const &r2) {
+                return r1.rows == r2.rows && r1.line == r2.line && r1.ec == r2.ec;
+            }
+        }
+
+        /**
+         * Checks that CsvReader gives the values of parse() for the fields of a text split into several chunks, skips
+         * the blank lines and the carriage returns, and reports the line of the errors.
+         */
+        inline bool checkCsvReader() {
+            std::size_t const rowCount = 3 * CsvReader::minChunkSize / 48;
+            std::size_t badLine = 0;
+            detail::CsvTestColumns expected, read;
+            std::string text = detail::csvTestText(rowCount, rowCount, badLine, expected);
+            if(text.size() < 2 * CsvReader::minChunkSize) {
+                return false;
+            }
+
+            CsvReader reader(text.data(), text.data() + text.size());
+            reader.bind("t", read.t);
+            reader.bind("x", read.x);
+            reader.bind("a", read.a);
+            bool ok = detail::sameResult(reader.read(4), CsvResult{rowCount, 0, std::errc()});
+            ok = ok && detail::sameValues(read.t, expected.t) && detail::sameValues(read.x, expected.x) &&
+                 detail::sameValues(read.a, expected.a);
+
+            // An invalid field in the last chunk.
+            detail::CsvTestColumns ignored;
+            text = detail::csvTestText(rowCount, rowCount - 10, badLine, ignored);
+            CsvReader badReader(text.data(), text.data() + text.size());
+            badReader.bind("x", read.x);
+            ok = ok && detail::sameResult(badReader.read(4), CsvResult{0, badLine, std::errc::invalid_argument});
+
+            ok = ok && detail::sameResult(detail::readCsvTestColumn<Time>("t[ms]\r\n1\r\n\r\n2\n  \n3\nx\n", "t"),
+                                          CsvResult{0, 7, std::errc::invalid_argument});
+            ok = ok && detail::sameResult(detail::readCsvTestColumn<Time>("t[ms]\n1\n2,3\n", "t"),
+                                          CsvResult{2, 0, std::errc()});
+            // The unit must have the dimension of the column, and the column must be in the header.
+            ok = ok && detail::sameResult(detail::readCsvTestColumn<Time>("t[mm]\n1\n", "t"),
+                                          CsvResult{0, 1, std::errc::invalid_argument});
+            ok = ok && detail::sameResult(detail::readCsvTestColumn<Length>("t\n1\n", "t"),
+                                          CsvResult{0, 1, std::errc::invalid_argument});
+            ok = ok && detail::sameResult(detail::readCsvTestColumn<Time>("s[ms]\n1\n", "t"),
+                                          CsvResult{0, 1, std::errc::invalid_argument});
+            ok = ok && detail::sameResult(detail::readCsvTestColumn<Time>("", "t"),
+                                          CsvResult{0, 1, std::errc::invalid_argument});
+            return ok;
+        }
+    }
+}
+
+#endif
+
+#endif
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  DynamicQuantity.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_DynamicQuantity_h
+#define Units_DynamicQuantity_h
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "Batch.h"
+#include "QuantitySpan.h"
+#include "Unit.h"
+
+namespace Units {
+
+    /**
+     * The dimension of a quantity known at run time only, packed in a single integer: each of the Kg, M and S exponents
+     * takes one byte, with a bias of 128 (i.e. exponents from -128 to 127). The dimension of a product is then the sum
+     * of the packed values minus the packed bias, and comparing two dimensions is a single integer comparison.
+     * The most significant bit flags an invalid dimension, which results from the sum or the comparison of quantities
+     * of different dimensions and is propagated by the products.
+     */
+    class DynamicDimension {
+    public:
+        using PackedType = std::uint32_t;
+
+        /**
+         * Creates the dimension of dimensionless quantities.
+         */
+        constexpr DynamicDimension() = default;
+
+        /**
+         * Creates the dimension kg^kg·m^m·s^s.
+         */
+        static constexpr DynamicDimension make(int kg, int m, int s) {
+            return DynamicDimension(PackedType(kg + 128) | PackedType(m + 128) << 8 | PackedType(s + 128) << 16);
+        }
+
+        /**
+         * Returns the dimension of the quantity type Q.
+         */
+        template <typename Q>
+        static constexpr DynamicDimension of() {
+            return fromUnit(static_cast<Q const *>(nullptr));
+        }
+
+        static constexpr DynamicDimension invalid() {
+            return DynamicDimension(invalidFlag);
+        }
+
+        static constexpr DynamicDimension makeFromPacked(PackedType packed) {
+            return DynamicDimension(packed);
+        }
+
+        constexpr PackedType toPacked() const {
+            return _packed;
+        }
+
+        constexpr bool isValid() const {
+            return (_packed & invalidFlag) == 0;
+        }
+
+        constexpr int kg() const {
+            return int(_packed & 0xFF) - 128;
+        }
+
+        constexpr int m() const {
+            return int(_packed >> 8 & 0xFF) - 128;
+        }
+
+        constexpr int s() const {
+            return int(_packed >> 16 & 0xFF) - 128;
+        }
+
+        constexpr friend bool operator==(DynamicDimension const &d1, DynamicDimension const &d2) {
+            return d1._packed == d2._packed;
+        }
+
+        constexpr friend bool operator!=(DynamicDimension const &d1, DynamicDimension const &d2) {
+            return d1._packed != d2._packed;
+        }
+
+        /**
+         * The dimension of the product of two quantities.
+         */
+        constexpr friend DynamicDimension operator*(DynamicDimension const &d1, DynamicDimension const &d2) {
+            return DynamicDimension((d1._packed + d2._packed - bias) | ((d1._packed | d2._packed) & invalidFlag));
+        }
+
+        /**
+         * The dimension of the quotient of two quantities.
+         */
+        constexpr friend DynamicDimension operator/(DynamicDimension const &d1, DynamicDimension const &d2) {
+            return DynamicDimension((d1._packed - d2._packed + bias) | ((d1._packed | d2._packed) & invalidFlag));
+        }
+
+    private:
+        static constexpr PackedType bias = 0x808080;
+        static constexpr PackedType invalidFlag = PackedType(1) << 31;
+
+        constexpr explicit DynamicDimension(PackedType packed) : _packed(packed) {}
+
+        template <int Kg, int M, int S, typename T>
+        static constexpr DynamicDimension fromUnit(Unit<Kg, M, S, true, T> const *) {
+            static_assert(Kg >= -128 && Kg <= 127 && M >= -128 && M <= 127 && S >= -128 && S <= 127,
+                          "The exponents of a dynamic dimension are stored on 8 bits.");
+            return make(Kg, M, S);
+        }
+
+        PackedType _packed = bias;
+    };
+
+    /**
+     * A physical quantity whose dimension is only known at run time, e.g. for a configuration or scripting layer.
+     * It is made of a raw value, as returned by Unit::toValue(), and of its DynamicDimension. Any Unit converts to a
+     * dynamic quantity, and back with a single comparison of the dimensions.
+     * The products and quotients are always defined. The sums and differences of quantities of different dimensions
+     * give a quantity of invalid dimension, which cannot be converted back to a Unit, and their comparisons are false.
+     *
+     * @param T the arithmetic type used to store the numerical value.
+     */
+    template <typename T>
+    class BasicDynamicQuantity {
+    public:
+        using ValueType = T;
+
+        /**
+         * Creates a dimensionless null quantity.
+         */
+        constexpr BasicDynamicQuantity() = default;
+
+        constexpr BasicDynamicQuantity(ValueType value, DynamicDimension dimension) : _value(value), _dimension(dimension) {}
+
+        /**
+         * Creates a dynamic quantity from a static one.
+         */
+        template <int Kg, int M, int S, typename U>
+        constexpr BasicDynamicQuantity(Unit<Kg, M, S, true, U> const &q)
+                : _value(static_cast<ValueType>(q.toValue())), _dimension(DynamicDimension::of<Unit<Kg, M, S, true, U>>()) {}
+
+        constexpr ValueType toValue() const {
+            return _value;
+        }
+
+        constexpr DynamicDimension dimension() const {
+            return _dimension;
+        }
+
+        /**
+         * Returns whether the quantity has the dimension of Q.
+         */
+        template <typename Q>
+        constexpr bool is() const {
+            return _dimension == DynamicDimension::of<Q>();
+        }
+
+        /**
+         * Converts the quantity to the static type Q if it has its dimension, and returns whether it has.
+         */
+        template <int Kg, int M, int S, typename U>
+        bool get(Unit<Kg, M, S, true, U> &q) const {
+            if(!is<Unit<Kg, M, S, true, U>>()) {
+                return false;
+            }
+            q = Unit<Kg, M, S, true, U>::makeFromValue(static_cast<U>(_value));
+            return true;
+        }
+
+        /**
+         * Converts the quantity to the static type Q, which must have its dimension.
+         */
+        template <typename Q>
+        constexpr Q as() const {
+            return assert(is<Q>()), Q::makeFromValue(static_cast<typename Q::ValueType>(_value));
+        }
+
+        constexpr BasicDynamicQuantity operator-() const {
+            return BasicDynamicQuantity(-_value, _dimension);
+        }
+
+        constexpr friend BasicDynamicQuantity operator+(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return BasicDynamicQuantity(q1._value + q2._value, sameDimension(q1, q2));
+        }
+
+        constexpr friend BasicDynamicQuantity operator-(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return BasicDynamicQuantity(q1._value - q2._value, sameDimension(q1, q2));
+        }
+
+        constexpr friend BasicDynamicQuantity operator*(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return BasicDynamicQuantity(q1._value * q2._value, q1._dimension * q2._dimension);
+        }
+
+        constexpr friend BasicDynamicQuantity operator/(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return BasicDynamicQuantity(q1._value / q2._value, q1._dimension / q2._dimension);
+        }
+
+        constexpr friend bool operator==(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return q1._dimension == q2._dimension && q1._value == q2._value;
+        }
+
+        constexpr friend bool operator!=(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return !(q1 == q2);
+        }
+
+        constexpr friend bool operator<(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return q1._dimension == q2._dimension && q1._value < q2._value;
+        }
+
+        constexpr friend bool operator>(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return q2 < q1;
+        }
+
+        constexpr friend bool operator<=(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return q1._dimension == q2._dimension && q1._value <= q2._value;
+        }
+
+        constexpr friend bool operator>=(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return q2 <= q1;
+        }
+
+    private:
+        static constexpr DynamicDimension sameDimension(BasicDynamicQuantity const &q1, BasicDynamicQuantity const &q2) {
+            return q1._dimension == q2._dimension ? q1._dimension : DynamicDimension::invalid();
+        }
+
+        ValueType _value = 0;
+        DynamicDimension _dimension;
+    };
+
+    using DynamicQuantity = BasicDynamicQuantity<UnitBase::ValueType>;
+
+    /**
+     * A non-owning view over a column of raw values sharing a dimension known at run time only. The dimension is
+     * checked once for the whole column when it is converted to a QuantitySpan, and the element-wise operations below
+     * check it once before running the kernels of Batch.h on the raw values.
+     *
+     * @param T the arithmetic type of the raw values.
+     */
+    template <typename T>
+    class BasicDynamicQuantitySpan {
+    public:
+        using ValueType = T;
+
+        constexpr BasicDynamicQuantitySpan() = default;
+
+        constexpr BasicDynamicQuantitySpan(ValueType *data, std::size_t size, DynamicDimension dimension)
+                : _data(data), _size(size), _dimension(dimension) {}
+
+        /**
+         * Creates a dynamic view over a span of static quantities.
+         */
+        template <int Kg, int M, int S>
+        constexpr BasicDynamicQuantitySpan(QuantitySpan<Unit<Kg, M, S, true, T>> const &s)
+                : BasicDynamicQuantitySpan(s.data(), s.size(), DynamicDimension::make(Kg, M, S)) {}
+
+        constexpr std::size_t size() const {
+            return _size;
+        }
+
+        constexpr bool empty() const {
+            return _size == 0;
+        }
+
+        constexpr ValueType *data() const {
+            return _data;
+        }
+
+        constexpr DynamicDimension dimension() const {
+            return _dimension;
+        }
+
+        /**
+         * Changes the dimension of the viewed values, e.g. before an operation writes another kind of quantity in them.
+         */
+        void setDimension(DynamicDimension dimension) {
+            _dimension = dimension;
+        }
+
+        constexpr BasicDynamicQuantity<T> operator[](std::size_t index) const {
+            return BasicDynamicQuantity<T>(_data[index], _dimension);
+        }
+
+        /**
+         * Views the column as a span of static quantities of type Q if it has their dimension, and returns whether
+         * it has.
+         */
+        template <int Kg, int M, int S>
+        bool get(QuantitySpan<Unit<Kg, M, S, true, T>> &s) const {
+            if(_dimension != DynamicDimension::make(Kg, M, S)) {
+                return false;
+            }
+            s = QuantitySpan<Unit<Kg, M, S, true, T>>(_data, _size);
+            return true;
+        }
+
+    private:
+        ValueType *_data = nullptr;
+        std::size_t _size = 0;
+        DynamicDimension _dimension;
+    };
+
+    using DynamicQuantitySpan = BasicDynamicQuantitySpan<UnitBase::ValueType>;
+
+    namespace Batch {
+        namespace detail {
+            template <typename T>
+            QuantitySpan<Unit<0, 0, 0, true, T>> rawSpan(BasicDynamicQuantitySpan<T> const &s) {
+                return QuantitySpan<Unit<0, 0, 0, true, T>>(s.data(), s.size());
+            }
+        }
+
+        /**
+         * out[i] = a[i] + b[i], if a and b have the same dimension, which is then given to out. Returns whether they
+         * have, and does not change out otherwise.
+         */
+        template <typename T>
+        bool add(BasicDynamicQuantitySpan<T> const &a, BasicDynamicQuantitySpan<T> const &b, BasicDynamicQuantitySpan<T> &out) {
+            if(a.dimension() != b.dimension()) {
+                return false;
+            }
+            add(detail::rawSpan(a), detail::rawSpan(b), detail::rawSpan(out));
+            out.setDimension(a.dimension());
+            return true;
+        }
+
+        /**
+         * out[i] = a[i] - b[i], if a and b have the same dimension, which is then given to out. Returns whether they
+         * have, and does not change out otherwise.
+         */
+        template <typename T>
+        bool subtract(BasicDynamicQuantitySpan<T> const &a, BasicDynamicQuantitySpan<T> const &b, BasicDynamicQuantitySpan<T> &out) {
+            if(a.dimension() != b.dimension()) {
+                return false;
+            }
+            subtract(detail::rawSpan(a), detail::rawSpan(b), detail::rawSpan(out));
+            out.setDimension(a.dimension());
+            return true;
+        }
+
+        /**
+         * out[i] = a[i] * b[i], out being given the dimension of the product.
+         */
+        template <typename T>
+        void multiply(BasicDynamicQuantitySpan<T> const &a, BasicDynamicQuantitySpan<T> const &b, BasicDynamicQuantitySpan<T> &out) {
+            multiply(detail::rawSpan(a), detail::rawSpan(b), detail::rawSpan(out));
+            out.setDimension(a.dimension() * b.dimension());
+        }
+
+        /**
+         * out[i] = a[i] / b[i], out being given the dimension of the quotient.
+         */
+        template <typename T>
+        void divide(BasicDynamicQuantitySpan<T> const &a, BasicDynamicQuantitySpan<T> const &b, BasicDynamicQuantitySpan<T> &out) {
+            divide(detail::rawSpan(a), detail::rawSpan(b), detail::rawSpan(out));
+            out.setDimension(a.dimension() / b.dimension());
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  ExactDuration.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_ExactDuration_h
+#define Units_ExactDuration_h
+
+#include <chrono>
+#include <iosfwd>
+#include <type_traits>
+#include "Time.h"
+
+namespace Units {
+
+    /**
+     * Class representing a time/duration quantity stored as an integral count of nanoseconds.
+     * Contrary to Time, whose floating-point value is expressed in seconds, its arithmetic and its conversions from and
+     * to std::chrono::nanoseconds are exact, and do not involve any floating-point computation.
+     * It is meant for timestamp arithmetic (see TimePoint), while Time stays the quantity type of choice for physics.
+     */
+    class ExactDuration {
+        template <typename U>
+        using EnableIfIntegral = std::enable_if_t<std::is_integral<U>::value, bool>;
+
+    public:
+        using ValueType = std::chrono::nanoseconds::rep;
+
+        friend std::ostream &operator<<(std::ostream &s, ExactDuration const &d);
+
+        /**
+         * Default constructor, creates a zero duration.
+         */
+        constexpr ExactDuration() = default;
+
+        /**
+         * Returns a new duration from the value specified in nanoseconds.
+         */
+        static constexpr ExactDuration makeFromNs(ValueType ns) {
+            return ExactDuration(ns);
+        }
+
+        /**
+         * Returns a new duration from the value specified in microseconds.
+         */
+        static constexpr ExactDuration makeFromUs(ValueType us) {
+            return ExactDuration(us * 1000);
+        }
+
+        /**
+         * Returns a new duration from the value specified in milliseconds.
+         */
+        static constexpr ExactDuration makeFromMs(ValueType ms) {
+            return ExactDuration(ms * 1000000);
+        }
+
+        /**
+         * Returns a new duration from the value specified in seconds.
+         */
+        static constexpr ExactDuration makeFromS(ValueType s) {
+            return ExactDuration(s * 1000000000);
+        }
+
+        /**
+         * Returns a new duration from the specified std::chrono::duration. The conversion is exact for any duration
+         * whose period is a multiple of a nanosecond, and truncates toward zero otherwise.
+         */
+        template <typename Rep, typename Period>
+        static constexpr ExactDuration makeFromSystemDelay(std::chrono::duration<Rep, Period> const &delay) {
+            return ExactDuration(std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count());
+        }
+
+        /**
+         * Returns a new duration from a Time quantity, rounded to the nearest nanosecond. The durations out of the range
+         * of ValueType (about ±292 years) are clamped to it, and NaN gives a zero duration.
+         */
+        template <typename T>
+        static constexpr ExactDuration makeFromTime(BasicTime<T> const &t) {
+            return ExactDuration(roundNs(t.toS() * 1e9));
+        }
+
+        /**
+         * Returns the value of the duration in nanoseconds.
+         */
+        constexpr ValueType toNs() const {
+            return _ns;
+        }
+
+        /**
+         * Returns the duration as a Time quantity.
+         */
+        constexpr Time toTime() const {
+            return Time::makeFromNs(_ns);
+        }
+
+        /**
+         * Returns the value of the duration as a std::chrono::nanoseconds object. The conversion is exact.
+         */
+        constexpr std::chrono::nanoseconds toSystemDelay() const {
+            return std::chrono::nanoseconds(_ns);
+        }
+
+        constexpr operator std::chrono::nanoseconds() const {
+            return this->toSystemDelay();
+        }
+
+        constexpr ExactDuration operator-() const {
+            return ExactDuration(-_ns);
+        }
+
+        constexpr ExactDuration operator+() const {
+            return *this;
+        }
+
+        constexpr ExactDuration &operator+=(ExactDuration const &d) {
+            _ns += d._ns;
+            return *this;
+        }
+
+        constexpr ExactDuration &operator-=(ExactDuration const &d) {
+            _ns -= d._ns;
+            return *this;
+        }
+
+        /**
+         * Multiplies the duration by an integral value. There is no overload for floating-point factors, which would be
+         * truncated: scale the Time quantity instead, e.g. ExactDuration::makeFromTime(d.toTime() * 0.5).
+         */
+        template <typename U, EnableIfIntegral<U> = true>
+        constexpr ExactDuration &operator*=(U v) {
+            _ns *= ValueType(v);
+            return *this;
+        }
+
+        /**
+         * Divides the duration by an integral value, truncating the result toward zero. Like the factors of operator*=,
+         * the floating-point divisors are not accepted.
+         */
+        template <typename U, EnableIfIntegral<U> = true>
+        constexpr ExactDuration &operator/=(U v) {
+            _ns /= ValueType(v);
+            return *this;
+        }
+
+        constexpr friend ExactDuration operator+(ExactDuration const &d1, ExactDuration const &d2) {
+            return ExactDuration(d1._ns + d2._ns);
+        }
+
+        constexpr friend ExactDuration operator-(ExactDuration const &d1, ExactDuration const &d2) {
+            return ExactDuration(d1._ns - d2._ns);
+        }
+
+        /**
+         * Multiplies the duration by an integral value (see operator*=).
+         */
+        template <typename U, EnableIfIntegral<U> = true>
+        constexpr friend ExactDuration operator*(ExactDuration const &d, U v) {
+            return ExactDuration(d._ns * ValueType(v));
+        }
+
+        template <typename U, EnableIfIntegral<U> = true>
+        constexpr friend ExactDuration operator*(U v, ExactDuration const &d) {
+            return ExactDuration(ValueType(v) * d._ns);
+        }
+
+        /**
+         * Divides the duration by an integral value, truncating the result toward zero (see operator/=).
+         */
+        template <typename U, EnableIfIntegral<U> = true>
+        constexpr friend ExactDuration operator/(ExactDuration const &d, U v) {
+            return ExactDuration(d._ns / ValueType(v));
+        }
+
+        /**
+         * Returns how many times d2 fits in d1, truncated toward zero.
+         */
+        constexpr friend ValueType operator/(ExactDuration const &d1, ExactDuration const &d2) {
+            return d1._ns / d2._ns;
+        }
+
+        /**
+         * Returns the remainder of the division of d1 by d2. E.g. 1500 ms % 1 s gives 500 ms.
+         */
+        constexpr friend ExactDuration operator%(ExactDuration const &d1, ExactDuration const &d2) {
+            return ExactDuration(d1._ns % d2._ns);
+        }
+
+        constexpr friend bool operator==(ExactDuration const &d1, ExactDuration const &d2) {
+            return d1._ns == d2._ns;
+        }
+
+        constexpr friend bool operator!=(ExactDuration const &d1, ExactDuration const &d2) {
+            return !(d1 == d2);
+        }
+
+        constexpr friend bool operator<(ExactDuration const &d1, ExactDuration const &d2) {
+            return d1._ns < d2._ns;
+        }
+
+        constexpr friend bool operator>(ExactDuration const &d1, ExactDuration const &d2) {
+            return d2 < d1;
+        }
+
+        constexpr friend bool operator<=(ExactDuration const &d1, ExactDuration const &d2) {
+            return !(d2 < d1);
+        }
+
+        constexpr friend bool operator>=(ExactDuration const &d1, ExactDuration const &d2) {
+            return !(d1 < d2);
+        }
+
+    private:
+        constexpr explicit ExactDuration(ValueType ns) : _ns(ns) {}
+
+        template <typename T>
+        static constexpr ValueType roundNs(T ns) {
+            return OverflowPolicy::Saturate::convert<ValueType>(ns + (ns < 0 ? T(-0.5) : T(0.5)));
+        }
+
+        ValueType _ns = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  Format.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_Format_h
+#define Units_Format_h
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+#include "ExactDuration.h"
+#include "Unit.h"
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+namespace Units {
+
+    /**
+     * The result of format_to(), with the same members as std::to_chars_result: ptr is one past the last written
+     * character on success, and last with ec == std::errc::value_too_large if the buffer is too small.
+     */
+    struct FormatResult {
+        char *ptr;
+        std::errc ec;
+    };
+
+    namespace detail {
+        /**
+         * Selects the unit in which a quantity of dimension (Kg, M, S) is printed, and scales the value accordingly.
+         * Returns the symbol of the unit, or nullptr for the coherent SI unit of the dimension (e.g. kg·m·s⁻²), which is
+         * written by derivedSuffix(). The scaling thresholds are the ones of the operator<< overloads.
+         */
+        template <int Kg, int M, int S>
+        struct DisplayUnit {
+            template <typename T>
+            static constexpr char const *scale(T &) {
+                return nullptr;
+            }
+        };
+
+        template <>
+        struct DisplayUnit<0, 1, 0> {
+            template <typename T>
+            static char const *scale(T &v) {
+                T const magnitude = v < 0 ? -v : v;
+                if(magnitude >= 1) {
+                    return "m";
+                }
+                if(magnitude >= T(1e-2)) {
+                    v *= T(1e2);
+                    return "cm";
+                }
+                v *= T(1e3);
+                return "mm";
+            }
+        };
+
+        template <>
+        struct DisplayUnit<0, 1, -1> {
+            template <typename T>
+            static char const *scale(T &v) {
+                T const magnitude = v < 0 ? -v : v;
+                if(magnitude >= 1) {
+                    return "m/s";
+                }
+                if(magnitude >= T(1e-2)) {
+                    v *= T(1e2);
+                    return "cm/s";
+                }
+                v *= T(1e3);
+                return "mm/s";
+            }
+        };
+
+        template <>
+        struct DisplayUnit<0, 0, 1> {
+            template <typename T>
+            static char const *scale(T &v) {
+                T const magnitude = v < 0 ? -v : v;
+                if(magnitude >= 3600) {
+                    v /= T(3600);
+                    return "h";
+                }
+                if(magnitude >= 60) {
+                    v /= T(60);
+                    return "min";
+                }
+                if(magnitude >= 1) {
+                    return "s";
+                }
+                if(magnitude >= T(1e-3)) {
+                    v *= T(1e3);
+                    return "ms";
+                }
+                if(magnitude >= T(1e-6)) {
+                    v *= T(1e6);
+                    return "us";
+                }
+                v *= T(1e9);
+                return "ns";
+            }
+        };
+
+        inline bool appendString(char *&ptr, char *last, char const *s, std::size_t length) {
+            if(std::size_t(last - ptr) < length) {
+                return false;
+            }
+            std::memcpy(ptr, s, length);
+            ptr += length;
+            return true;
+        }
+
+        inline bool appendString(char *&ptr, char *last, char const *s) {
+            return appendString(ptr, last, s, std::strlen(s));
+        }
+
+        /**
+         * Appends a base unit symbol and its exponent in superscript, e.g. m² or s⁻¹.
+         */
+        inline bool appendPower(char *&ptr, char *last, char const *symbol, int exponent, bool &first) {
+            static char const *const superscripts[] = {"⁰", "¹", "²", "³", "⁴", "⁵", "⁶", "⁷", "⁸", "⁹"};
+
+            if(exponent == 0) {
+                return true;
+            }
+            if(!first && !appendString(ptr, last, "·")) {
+                return false;
+            }
+            first = false;
+            if(!appendString(ptr, last, symbol)) {
+                return false;
+            }
+            if(exponent == 1) {
+                return true;
+            }
+            if(exponent < 0 && !appendString(ptr, last, "⁻")) {
+                return false;
+            }
+
+            unsigned magnitude = exponent < 0 ? 0u - unsigned(exponent) : unsigned(exponent);
+            unsigned divisor = 1;
+            while(magnitude / divisor >= 10) {
+                divisor *= 10;
+            }
+            for(; divisor > 0; divisor /= 10) {
+                if(!appendString(ptr, last, superscripts[magnitude / divisor % 10])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Appends the symbol of the coherent SI unit of the dimension (Kg, M, S), e.g. kg·m²·s⁻².
+         */
+        inline bool appendDerivedSuffix(char *&ptr, char *last, int kg, int m, int s) {
+            bool first = true;
+            return appendPower(ptr, last, "kg", kg, first) && appendPower(ptr, last, "m", m, first) &&
+                   appendPower(ptr, last, "s", s, first);
+        }
+
+#ifdef __cpp_lib_to_chars
+        template <typename T>
+        std::enable_if_t<std::is_floating_point<T>::value, bool> appendNumber(char *&ptr, char *last, T v, int precision) {
+            auto const result = std::to_chars(ptr, last, v, std::chars_format::general, precision);
+            ptr = result.ptr;
+            return result.ec == std::errc();
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value, bool> appendNumber(char *&ptr, char *last, T v, int) {
+            auto const result = std::to_chars(ptr, last, v);
+            ptr = result.ptr;
+            return result.ec == std::errc();
+        }
+#else
+        /**
+         * Without std::to_chars, the numbers are written with std::snprintf, which needs one more character for its
+         * terminating null character, and uses the decimal separator of the C locale in effect.
+         */
+        inline bool appendSnprintf(char *&ptr, char *last, int length) {
+            if(length < 0 || length >= last - ptr) {
+                return false;
+            }
+            ptr += length;
+            return true;
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_floating_point<T>::value, bool> appendNumber(char *&ptr, char *last, T v, int precision) {
+            return appendSnprintf(ptr, last, std::snprintf(ptr, std::size_t(last - ptr), "%.*Lg", precision, (long double)v));
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value, bool>
+            appendNumber(char *&ptr, char *last, T v, int) {
+            return appendSnprintf(ptr, last, std::snprintf(ptr, std::size_t(last - ptr), "%lld", (long long)v));
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value, bool>
+            appendNumber(char *&ptr, char *last, T v, int) {
+            return appendSnprintf(ptr, last, std::snprintf(ptr, std::size_t(last - ptr), "%llu", (unsigned long long)v));
+        }
+#endif
+    }
+
+    /**
+     * Writes a quantity into the character buffer [first, last[, e.g. "1.5 km" is written as "1500 m" and 2_ms as
+     * "2 ms", without any allocation nor stream. The value goes through the same unit selection as the operator<<
+     * overloads (m/cm/mm, m/s/cm/s/mm/s, h/min/s/ms/us/ns), and is otherwise followed by the symbol of the coherent SI
+     * unit of its dimension (e.g. "9.81 m·s⁻²", "3 kg·m²·s⁻²"); dimensionless quantities have no symbol. The symbols are
+     * UTF-8 encoded.
+     * The number is written like std::printf's %g conversion with the given precision (6 by default, as iostreams
+     * do), with std::to_chars when the standard library provides it. No null character is appended.
+     */
+    template <int Kg, int M, int S, typename T>
+    FormatResult format_to(char *first, char *last, Unit<Kg, M, S, true, T> const &q, int precision = 6) {
+        T value = q.toValue();
+        char const *symbol = detail::DisplayUnit<Kg, M, S>::scale(value);
+
+        char *ptr = first;
+        bool written = detail::appendNumber(ptr, last, value, precision);
+        if(written && (Kg != 0 || M != 0 || S != 0)) {
+            written = detail::appendString(ptr, last, " ", 1) &&
+                      (symbol ? detail::appendString(ptr, last, symbol) : detail::appendDerivedSuffix(ptr, last, Kg, M, S));
+        }
+        if(!written) {
+            return FormatResult{last, std::errc::value_too_large};
+        }
+        return FormatResult{ptr, std::errc()};
+    }
+
+    /**
+     * Writes a duration into the character buffer [first, last[, the same way as its Time value.
+     */
+    inline FormatResult format_to(char *first, char *last, ExactDuration const &d, int precision = 6) {
+        return format_to(first, last, d.toTime(), precision);
+    }
+}
+
+#endif
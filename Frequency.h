@@ -33,22 +33,26 @@
 
 namespace Units {
 
+    template <typename T>
+    using BasicAngularSpeed = Unit<0, 0, -1, true, T>;
     using AngularSpeed = Unit<0, 0, -1, true>;
+    template <typename T>
+    using BasicFrequency = Unit<0, 0, -1, true, T>;
     using Frequency = Unit<0, 0, -1, true>;
 
     /**
      * Class representing a physical quatity in s⁻¹. It happens to be able to represent an angular speed (angle per
      * second) and frequency, hence its specialized methods.
      */
-    template <>
-    class Unit<0, 0, -1, true> : public Unit<0, 0, -1, false> {
-        friend class Unit<0, 0, -1, false>;
+    template <typename T>
+    class Unit<0, 0, -1, true, T> : public Unit<0, 0, -1, false, T> {
+        friend class Unit<0, 0, -1, false, T>;
 
     public:
-        using Unit<0, 0, -1, false>::ValueType;
-        using Type = Unit<0, 0, -1, true>;
+        using typename Unit<0, 0, -1, false, T>::ValueType;
+        using Type = Unit<0, 0, -1, true, T>;
 
-        friend std::ostream &operator<<(std::ostream &s, Type const &v);
+        friend std::ostream &operator<<(std::ostream &s, AngularSpeed const &v);
 
         /**
          * Returns a new angular speed from the value specified in radians per second.
@@ -81,37 +85,37 @@ namespace Units {
         /**
          * Returns the value of the angular speed in radians per second.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toRad_s() const {
-            return (*this * 2 * M_PI).value<Rep>();
+            return (*this * 2 * M_PI).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the angular speed in milliradians per second.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toMilliRad_s() const {
-            return (*this * 1000 * 2 * M_PI).value<Rep>();
+            return (*this * 1000 * 2 * M_PI).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the angular speed in degrees per second.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toDeg_s() const {
-            return (*this * 360).value<Rep>();
+            return (*this * 360).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the frequency in Hertz.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toHz() const {
-            return (*this).value<Rep>();
+            return (*this).template value<Rep, Policy>();
         }
 
     private:
-        using Unit<0, 0, -1, false>::Unit;
+        using Unit<0, 0, -1, false, T>::Unit;
     };
 
     namespace UnitsLiterals {
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  LatencyHistogram.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_LatencyHistogram_h
+#define Units_LatencyHistogram_h
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include "Bits.h"
+#include "ExactDuration.h"
+#include "Time.h"
+
+namespace Units {
+
+    namespace detail {
+        /**
+         * Returns the shard of the calling thread, given round-robin to the threads on their first call.
+         */
+        inline std::size_t threadShard() {
+            static std::atomic<std::size_t> nextShard{0};
+            thread_local std::size_t const shard = nextShard.fetch_add(1, std::memory_order_relaxed);
+            return shard;
+        }
+    }
+
+    /**
+     * The counts of a LatencyHistogram at some point in time, with the statistics of the recorded durations.
+     * Snapshots of several histograms of the same type can be merged with operator+=.
+     */
+    template <int SubBucketBits>
+    class LatencyHistogramSnapshot {
+    public:
+        static constexpr std::size_t bucketCount = std::size_t(64 - SubBucketBits + 2) << (SubBucketBits - 1);
+
+        /**
+         * Returns the bucket of a duration of ns nanoseconds: the durations below 2^SubBucketBits ns have their own
+         * bucket, and every power of two above is split into 2^(SubBucketBits - 1) buckets of equal width, so that
+         * the relative error on a duration is below 2^(1 - SubBucketBits).
+         */
+        static std::size_t bucketOf(std::uint64_t ns) {
+            if(ns < (std::uint64_t(1) << SubBucketBits)) {
+                return std::size_t(ns);
+            }
+            int const shift = detail::mostSignificantBit(ns) - SubBucketBits + 1;
+            return (std::size_t(shift) << (SubBucketBits - 1)) + std::size_t(ns >> shift);
+        }
+
+        /**
+         * Returns the largest duration, in nanoseconds, recorded in the given bucket.
+         */
+        static std::uint64_t highestValueOf(std::size_t bucket) {
+            std::size_t const half = std::size_t(1) << (SubBucketBits - 1);
+            if(bucket < 2 * half) {
+                return bucket;
+            }
+            std::size_t const shift = bucket / half - 1;
+            std::uint64_t const sub = bucket % half + half;
+            return ((sub + 1) << shift) - 1;
+        }
+
+        LatencyHistogramSnapshot() {
+            _counts.fill(0);
+        }
+
+        /**
+         * The number of recorded durations.
+         */
+        std::uint64_t count() const {
+            return _count;
+        }
+
+        std::uint64_t countOf(std::size_t bucket) const {
+            return _counts[bucket];
+        }
+
+        /**
+         * Returns the duration below which are the given percentage (from 0 to 100) of the recorded ones, e.g.
+         * percentile(99.9), with the precision of the buckets. The percentage is clamped to [0, 100]. Returns a null
+         * duration if nothing is recorded.
+         */
+        Duration percentile(double percent) const {
+            if(_count == 0) {
+                return Duration();
+            }
+            // Clamped before the conversion, which would be undefined for a NaN or out-of-range percentage.
+            double const position = std::ceil(percent / 100 * double(_count));
+            std::uint64_t const rank =
+                !(position > 1) ? 1 : position >= double(_count) ? _count : std::uint64_t(position);
+
+            std::uint64_t cumulated = 0;
+            for(std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                cumulated += _counts[bucket];
+                if(cumulated >= rank) {
+                    return Duration::makeFromNs(double(highestValueOf(bucket)));
+                }
+            }
+            return Duration::makeFromNs(double(highestValueOf(bucketCount - 1)));
+        }
+
+        Duration p50() const {
+            return percentile(50);
+        }
+
+        Duration p99() const {
+            return percentile(99);
+        }
+
+        Duration p999() const {
+            return percentile(99.9);
+        }
+
+        LatencyHistogramSnapshot &operator+=(LatencyHistogramSnapshot const &s) {
+            for(std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                _counts[bucket] += s._counts[bucket];
+            }
+            _count += s._count;
+            return *this;
+        }
+
+        void add(std::size_t bucket, std::uint64_t count) {
+            _counts[bucket] += count;
+            _count += count;
+        }
+
+    private:
+        std::array<std::uint64_t, bucketCount> _counts;
+        std::uint64_t _count = 0;
+    };
+
+    /**
+     * A log-linear (HDR-style) histogram of durations, e.g. latencies measured as differences of TimePoints, which
+     * many threads can record into concurrently without locks.
+     * Recording a duration is a single relaxed atomic increment, in the shard of the calling thread: each thread is
+     * given one of the ShardCount shards, each on its own cache lines, so that threads do not contend unless there are
+     * more of them than shards. snapshot() sums the shards while the writers keep on recording, so that it may miss
+     * the durations recorded during the call.
+     * The histogram holds ShardCount * bucketCount counters (240 KiB with the default parameters), so it should
+     * be allocated statically or on the heap rather than on the stack.
+     *
+     * @param SubBucketBits the precision of the buckets: the relative error on a duration is below
+     * 2^(1 - SubBucketBits), i.e. 3.1 % with 6 bits.
+     * @param ShardCount the number of shards.
+     */
+    template <int SubBucketBits = 6, std::size_t ShardCount = 16>
+    class BasicLatencyHistogram {
+        static_assert(SubBucketBits >= 1 && SubBucketBits <= 16, "The precision of the buckets must be from 1 to 16 bits.");
+
+    public:
+        using Snapshot = LatencyHistogramSnapshot<SubBucketBits>;
+
+        static constexpr std::size_t bucketCount = Snapshot::bucketCount;
+
+        BasicLatencyHistogram() {
+            reset();
+        }
+
+        BasicLatencyHistogram(BasicLatencyHistogram const &) = delete;
+        BasicLatencyHistogram &operator=(BasicLatencyHistogram const &) = delete;
+
+        /**
+         * Records a duration of ns nanoseconds.
+         */
+        void recordNs(std::uint64_t ns) {
+            _shards[detail::threadShard() % ShardCount].counts[Snapshot::bucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * Records a duration. Negative durations are recorded as null ones.
+         */
+        void record(ExactDuration const &d) {
+            recordNs(d.toNs() < 0 ? 0 : std::uint64_t(d.toNs()));
+        }
+
+        /**
+         * Records a duration, rounded to the nanosecond. Negative and NaN durations are recorded as null ones, and
+         * those beyond 2^64 ns (584 years) as the longest one.
+         */
+        void record(Duration const &d) {
+            double const ns = d.toS() * 1e9;
+            recordNs(!(ns > 0)                        ? 0
+                     : ns >= 18446744073709551616.0 ? std::numeric_limits<std::uint64_t>::max()
+                                                     : std::uint64_t(ns + 0.5));
+        }
+
+        /**
+         * Returns the counts of all the shards, summed while the writers keep on recording.
+         */
+        Snapshot snapshot() const {
+            Snapshot s;
+            for(auto const &shard : _shards) {
+                for(std::size_t bucket = 0; bucket < bucketCount; ++bucket) {
+                    std::uint64_t const count = shard.counts[bucket].load(std::memory_order_relaxed);
+                    if(count != 0) {
+                        s.add(bucket, count);
+                    }
+                }
+            }
+            return s;
+        }
+
+        /**
+         * Sets all the counts to zero. The durations recorded concurrently may or may not be kept.
+         */
+        void reset() {
+            for(auto &shard : _shards) {
+                for(auto &count : shard.counts) {
+                    count.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+    private:
+        struct alignas(64) Shard {
+            std::array<std::atomic<std::uint64_t>, bucketCount> counts;
+        };
+
+        std::array<Shard, ShardCount> _shards;
+    };
+
+    using LatencyHistogram = BasicLatencyHistogram<>;
+}
+
+#endif
@@ -33,21 +33,23 @@
 
 namespace Units {
 
+    template <typename T>
+    using BasicLength = Unit<0, 1, 0, true, T>;
     using Length = Unit<0, 1, 0, true>;
     using Distance = Length;
 
     /**
      * Class representing a length quantity.
      */
-    template <>
-    class Unit<0, 1, 0, true> : public Unit<0, 1, 0, false> {
-        friend class Unit<0, 1, 0, false>;
+    template <typename T>
+    class Unit<0, 1, 0, true, T> : public Unit<0, 1, 0, false, T> {
+        friend class Unit<0, 1, 0, false, T>;
 
     public:
-        using Unit<0, 1, 0, false>::ValueType;
-        using Type = Unit<0, 1, 0, true>;
+        using typename Unit<0, 1, 0, false, T>::ValueType;
+        using Type = Unit<0, 1, 0, true, T>;
 
-        friend std::ostream &operator<<(std::ostream &s, Type const &d);
+        friend std::ostream &operator<<(std::ostream &s, Length const &d);
 
         /**
          * Returns a new length from the value specified in millimetres.
@@ -87,45 +89,45 @@ namespace Units {
         /**
          * Returns the value of the length in millimetres.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toMm() const {
-            return (*this * 1000).value<Rep>();
+            return (*this * 1000).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the length in centimetres.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toCm() const {
-            return (*this * 100).value<Rep>();
+            return (*this * 100).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the length in decimetres.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toDm() const {
-            return (*this * 10).value<Rep>();
+            return (*this * 10).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the length in metres.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toM() const {
-            return (*this).value<Rep>();
+            return (*this).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the length in kilometres.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toKm() const {
-            return (*this / 1000).value<Rep>();
+            return (*this / 1000).template value<Rep, Policy>();
         }
 
     private:
-        using Unit<0, 1, 0, false>::Unit;
+        using Unit<0, 1, 0, false, T>::Unit;
     };
 
     namespace UnitsLiterals {
@@ -33,20 +33,22 @@
 
 namespace Units {
 
+    template <typename T>
+    using BasicMass = Unit<1, 0, 0, true, T>;
     using Mass = Unit<1, 0, 0, true>;
 
     /**
      * Class representing a mass quantity.
      */
-    template <>
-    class Unit<1, 0, 0, true> : public Unit<1, 0, 0, false> {
-        friend class Unit<1, 0, 0, false>;
+    template <typename T>
+    class Unit<1, 0, 0, true, T> : public Unit<1, 0, 0, false, T> {
+        friend class Unit<1, 0, 0, false, T>;
 
     public:
-        using Unit<1, 0, 0, false>::ValueType;
-        using Type = Unit<1, 0, 0, true>;
+        using typename Unit<1, 0, 0, false, T>::ValueType;
+        using Type = Unit<1, 0, 0, true, T>;
 
-        friend std::ostream &operator<<(std::ostream &stream, Type const &v);
+        friend std::ostream &operator<<(std::ostream &stream, Mass const &v);
 
         /**
          * Returns a new mass from the value specified in grammes.
@@ -65,13 +67,13 @@ namespace Units {
         /**
          * Returns the value of the mass in kilogrammes.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toKg() const {
-            return (*this).value<Rep>();
+            return (*this).template value<Rep, Policy>();
         }
 
     private:
-        using Unit<1, 0, 0, false>::Unit;
+        using Unit<1, 0, 0, false, T>::Unit;
     };
 
     namespace UnitsLiterals {
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  OverflowPolicy.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_OverflowPolicy_h
+#define Units_OverflowPolicy_h
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+
+/**
+ * The overflow policy used by the conversions of the quantities whose type does not specify its own (see
+ * OverflowPolicyOf). Defaults to OverflowPolicy::Count, or to OverflowPolicy::Ignore if UNITS_NO_OVERFLOW_CHECK is
+ * defined.
+ */
+#ifndef UNITS_DEFAULT_OVERFLOW_POLICY
+#ifdef UNITS_NO_OVERFLOW_CHECK
+#define UNITS_DEFAULT_OVERFLOW_POLICY Ignore
+#else
+#define UNITS_DEFAULT_OVERFLOW_POLICY Count
+#endif
+#endif
+
+namespace Units {
+    namespace detail {
+        template <typename U, typename T>
+        using EnableIfSameRep = std::enable_if_t<std::is_same<U, T>::value, bool>;
+
+        template <typename U, typename T>
+        using EnableIfFloatingToIntegral =
+            std::enable_if_t<!std::is_same<U, T>::value && std::is_floating_point<T>::value && std::is_integral<U>::value,
+                             bool>;
+
+        template <typename U, typename T>
+        using EnableIfFloatingToFloating =
+            std::enable_if_t<!std::is_same<U, T>::value && std::is_floating_point<T>::value &&
+                                 std::is_floating_point<U>::value,
+                             bool>;
+
+        template <typename U, typename T>
+        using EnableIfIntegralToFloating =
+            std::enable_if_t<!std::is_same<U, T>::value && std::is_integral<T>::value && std::is_floating_point<U>::value,
+                             bool>;
+
+        template <typename U, typename T>
+        using EnableIfIntegralToIntegral =
+            std::enable_if_t<!std::is_same<U, T>::value && std::is_integral<T>::value && std::is_integral<U>::value, bool>;
+
+        /**
+         * Returns 2^digits of the integral type U, i.e. the first positive value U can not represent, as a T.
+         */
+        template <typename U, typename T>
+        constexpr T integralUpperBound() {
+            return T(U(1) << (std::numeric_limits<U>::digits - 1)) * 2;
+        }
+
+        /**
+         * Whether static_cast<U>(v) gives v (rounded or truncated toward zero, as with any conversion between
+         * arithmetic types), which is the case unless v lies out of the range of U. Infinities and NaN are only
+         * representable by floating-point types.
+         */
+        template <typename U, typename T, EnableIfSameRep<U, T> = true>
+        constexpr bool isRepresentable(T) {
+            return true;
+        }
+
+        template <typename U, typename T, EnableIfFloatingToIntegral<U, T> = true>
+        constexpr bool isRepresentable(T v) {
+            // The lower bound -2^digits - 1 may round to -2^digits, which is itself representable.
+            return v < integralUpperBound<U, T>() &&
+                   (std::is_signed<U>::value ? v > -integralUpperBound<U, T>() - 1 || v == -integralUpperBound<U, T>()
+                                             : v > T(-1));
+        }
+
+        template <typename U, typename T, EnableIfFloatingToFloating<U, T> = true>
+        constexpr bool isRepresentable(T v) {
+            return std::numeric_limits<U>::max_exponent >= std::numeric_limits<T>::max_exponent ||
+                   !(v > std::numeric_limits<U>::max() || v < std::numeric_limits<U>::lowest()) || v - v != 0;
+        }
+
+        template <typename U, typename T, EnableIfIntegralToFloating<U, T> = true>
+        constexpr bool isRepresentable(T) {
+            return true;
+        }
+
+        template <typename U, typename T, EnableIfIntegralToIntegral<U, T> = true>
+        constexpr bool isRepresentable(T v) {
+            return v < 0 ? std::is_signed<U>::value && std::intmax_t(v) >= std::intmax_t(std::numeric_limits<U>::lowest())
+                         : std::uintmax_t(v) <= std::uintmax_t(std::numeric_limits<U>::max());
+        }
+
+        template <typename = void>
+        struct OverflowCounter {
+            static std::atomic<std::uint_least64_t> value;
+        };
+
+        template <typename D>
+        std::atomic<std::uint_least64_t> OverflowCounter<D>::value{0};
+    }
+
+    /**
+     * The policies applied when the numerical value of a quantity is converted to a representation that is not able to
+     * hold it, e.g. Length::toMm<std::int32_t>() for a length of 10^4 km.
+     * A policy is a class with a static function template convert<U>(T v) returning v converted to U. It can be chosen
+     * for a single conversion (e.g. length.toMm<std::int32_t, OverflowPolicy::Saturate>()), or for every conversion of a
+     * quantity type through OverflowPolicyOf.
+     * The conversions between identical representations are never checked.
+     */
+    namespace OverflowPolicy {
+        /**
+         * Selects the policy of the converted quantity type (see OverflowPolicyOf). It is the default policy argument of
+         * the conversions, so that the policy of a type is only looked up when one of its conversions is used.
+         */
+        struct Default {};
+
+        /**
+         * Does not check anything: the result of an out of range conversion is the one of static_cast (which is
+         * undefined behaviour from a floating-point type to an integral type).
+         */
+        struct Ignore {
+            template <typename U, typename T>
+            static constexpr U convert(T v) {
+                return static_cast<U>(v);
+            }
+        };
+
+        /**
+         * Clamps the values out of range to the nearest representable value. NaN values converted to an integral type
+         * give 0.
+         */
+        struct Saturate {
+            template <typename U, typename T>
+            static constexpr U convert(T v) {
+                return detail::isRepresentable<U>(v) ? static_cast<U>(v)
+                                                     : v > T(0) ? std::numeric_limits<U>::max()
+                                                                : v < T(0) ? std::numeric_limits<U>::lowest() : U(0);
+            }
+        };
+
+        /**
+         * Aborts the program on the spot (with a trap instruction when available, so that a debugger stops on the faulty
+         * conversion).
+         */
+        struct Trap {
+            template <typename U, typename T>
+            static constexpr U convert(T v) {
+                return detail::isRepresentable<U>(v) ? static_cast<U>(v) : (trap(), U(0));
+            }
+
+        private:
+            static void trap() {
+#if defined(__GNUC__) || defined(__clang__)
+                __builtin_trap();
+#else
+                std::abort();
+#endif
+            }
+        };
+
+        /**
+         * Counts the out of range conversions in a process-wide atomic counter, which can be read with count() (e.g. to
+         * be exported as a metric), and then saturates them like Saturate, so that the result stays defined. This is the
+         * default policy.
+         */
+        struct Count {
+            template <typename U, typename T>
+            static constexpr U convert(T v) {
+                return detail::isRepresentable<U>(v) ? static_cast<U>(v) : (increment(), Saturate::convert<U>(v));
+            }
+
+            /**
+             * Returns the number of out of range conversions since the start of the program or the last call to reset().
+             */
+            static std::uint_least64_t count() {
+                return detail::OverflowCounter<>::value.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * Resets the counter to 0.
+             */
+            static void reset() {
+                detail::OverflowCounter<>::value.store(0, std::memory_order_relaxed);
+            }
+
+        private:
+            static void increment() {
+                detail::OverflowCounter<>::value.fetch_add(1, std::memory_order_relaxed);
+            }
+        };
+    }
+
+    /**
+     * The overflow policy of the conversions of the quantity type Q. Specialize it to change the policy of a given type,
+     * e.g. to saturate every conversion of Length:
+     *     template <> struct Units::OverflowPolicyOf<Units::Length> { using type = Units::OverflowPolicy::Saturate; };
+     * The specialization must be declared before the first conversion of the type is instantiated.
+     */
+    template <typename Q>
+    struct OverflowPolicyOf {
+        using type = OverflowPolicy::UNITS_DEFAULT_OVERFLOW_POLICY;
+    };
+
+    template <typename Q>
+    using OverflowPolicyOf_t = typename OverflowPolicyOf<Q>::type;
+}
+
+#endif
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  Parse.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_Parse_h
+#define Units_Parse_h
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+#include "Unit.h"
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+namespace Units {
+
+    /**
+     * The result of parse(), with the same members as std::from_chars_result: ptr is one past the last parsed character
+     * on success, and first with ec == std::errc::invalid_argument if the text is not a quantity of the expected
+     * dimension.
+     */
+    struct ParseResult {
+        char const *ptr;
+        std::errc ec;
+    };
+
+    namespace detail {
+        /**
+         * A unit symbol accepted by parse(): its dimension, and the conversion of a value in this unit to the value
+         * stored by the quantity (value * multiplier / divisor).
+         */
+        struct ParseSuffix {
+            char const *name;
+            std::size_t length;
+            int kg;
+            int m;
+            int s;
+            double multiplier;
+            double divisor;
+        };
+
+        constexpr std::size_t parseSuffixLength(char const *s) {
+            return *s ? 1 + parseSuffixLength(s + 1) : 0;
+        }
+
+        constexpr ParseSuffix makeParseSuffix(char const *name, int kg, int m, int s, double multiplier, double divisor) {
+            return ParseSuffix{name, parseSuffixLength(name), kg, m, s, multiplier, divisor};
+        }
+
+        /**
+         * The symbols of the user-defined literals, without their leading underscore, and the ones written by format_to()
+         * that are not already literals (m/s, m², s⁻¹...).
+         */
+        constexpr ParseSuffix parseSuffixes[] = {
+            makeParseSuffix("mm", 0, 1, 0, 1, 1000),
+            makeParseSuffix("cm", 0, 1, 0, 1, 100),
+            makeParseSuffix("dm", 0, 1, 0, 1, 10),
+            makeParseSuffix("m", 0, 1, 0, 1, 1),
+            makeParseSuffix("km", 0, 1, 0, 1000, 1),
+            makeParseSuffix("g", 1, 0, 0, 1, 1000),
+            makeParseSuffix("kg", 1, 0, 0, 1, 1),
+            makeParseSuffix("ns", 0, 0, 1, 1, 1e9),
+            makeParseSuffix("us", 0, 0, 1, 1, 1e6),
+            makeParseSuffix("ms", 0, 0, 1, 1, 1e3),
+            makeParseSuffix("s", 0, 0, 1, 1, 1),
+            makeParseSuffix("min", 0, 0, 1, 60, 1),
+            makeParseSuffix("h", 0, 0, 1, 3600, 1),
+            makeParseSuffix("PI", 0, 0, 0, M_PI, 2 * M_PI),
+            makeParseSuffix("deg", 0, 0, 0, 1, 360),
+            makeParseSuffix("rad", 0, 0, 0, 1, 2 * M_PI),
+            makeParseSuffix("mrad", 0, 0, 0, 1, 1000 * 2 * M_PI),
+            makeParseSuffix("Hz", 0, 0, -1, 1, 1),
+            makeParseSuffix("s⁻¹", 0, 0, -1, 1, 1),
+            makeParseSuffix("PI_s", 0, 0, -1, M_PI, 2 * M_PI),
+            makeParseSuffix("deg_s", 0, 0, -1, 1, 360),
+            makeParseSuffix("rad_s", 0, 0, -1, 1, 2 * M_PI),
+            makeParseSuffix("mrad_s", 0, 0, -1, 1, 1000 * 2 * M_PI),
+            makeParseSuffix("mm_s", 0, 1, -1, 1, 1000),
+            makeParseSuffix("cm_s", 0, 1, -1, 1, 100),
+            makeParseSuffix("dm_s", 0, 1, -1, 1, 10),
+            makeParseSuffix("m_s", 0, 1, -1, 1, 1),
+            makeParseSuffix("mm/s", 0, 1, -1, 1, 1000),
+            makeParseSuffix("cm/s", 0, 1, -1, 1, 100),
+            makeParseSuffix("dm/s", 0, 1, -1, 1, 10),
+            makeParseSuffix("m/s", 0, 1, -1, 1, 1),
+            makeParseSuffix("mm2", 0, 2, 0, 1, 1000000),
+            makeParseSuffix("cm2", 0, 2, 0, 1, 10000),
+            makeParseSuffix("dm2", 0, 2, 0, 1, 100),
+            makeParseSuffix("m2", 0, 2, 0, 1, 1),
+            makeParseSuffix("m²", 0, 2, 0, 1, 1),
+        };
+
+        constexpr std::size_t parseSuffixCount = sizeof(parseSuffixes) / sizeof(parseSuffixes[0]);
+
+        /**
+         * The longest symbol of the table, in bytes; longer words are rejected without being hashed.
+         */
+        constexpr std::size_t parseSuffixMaxLength = 8;
+
+        /**
+         * FNV-1a hash of a symbol, with the seed as offset basis.
+         */
+        constexpr std::uint32_t parseSuffixHash(char const *s, std::size_t length, std::uint32_t seed) {
+            std::uint32_t hash = seed;
+            for(std::size_t i = 0; i < length; ++i) {
+                hash = (hash ^ std::uint8_t(s[i])) * 16777619u;
+            }
+            return hash;
+        }
+
+        /**
+         * Perfect hash table of the symbols, built at compile time: the table has 256 slots indexed by the high byte of
+         * the hash, and the seed is the first one for which no two symbols share a slot. Each slot holds the index of its
+         * symbol plus one, or 0 if it is empty.
+         */
+        struct ParseSuffixTable {
+            static constexpr std::size_t slotBits = 8;
+            static constexpr std::size_t slotCount = std::size_t(1) << slotBits;
+
+            static constexpr std::size_t slotOf(char const *s, std::size_t length, std::uint32_t seed) {
+                return parseSuffixHash(s, length, seed) >> (32 - slotBits);
+            }
+
+            static constexpr bool isPerfect(std::uint32_t seed) {
+                bool used[slotCount] = {};
+                for(std::size_t i = 0; i < parseSuffixCount; ++i) {
+                    std::size_t const slot = slotOf(parseSuffixes[i].name, parseSuffixes[i].length, seed);
+                    if(used[slot]) {
+                        return false;
+                    }
+                    used[slot] = true;
+                }
+                return true;
+            }
+
+            static constexpr std::uint32_t findSeed() {
+                std::uint32_t seed = 2166136261u;
+                while(!isPerfect(seed)) {
+                    ++seed;
+                }
+                return seed;
+            }
+
+            constexpr ParseSuffixTable() : seed(findSeed()) {
+                for(std::size_t i = 0; i < parseSuffixCount; ++i) {
+                    slots[slotOf(parseSuffixes[i].name, parseSuffixes[i].length, seed)] = std::uint8_t(i + 1);
+                }
+            }
+
+            /**
+             * Returns the symbol [s, s + length[, or nullptr if it is unknown.
+             */
+            ParseSuffix const *find(char const *s, std::size_t length) const {
+                if(length == 0 || length > parseSuffixMaxLength) {
+                    return nullptr;
+                }
+                std::uint8_t const index = slots[slotOf(s, length, seed)];
+                if(index == 0) {
+                    return nullptr;
+                }
+                ParseSuffix const &suffix = parseSuffixes[index - 1];
+                if(suffix.length != length || std::memcmp(suffix.name, s, length) != 0) {
+                    return nullptr;
+                }
+                return &suffix;
+            }
+
+            std::uint32_t seed;
+            std::uint8_t slots[slotCount] = {};
+        };
+
+        static_assert(parseSuffixCount < 256, "The slots of the suffix table hold 8-bit indices.");
+
+        /**
+         * Holds the table as a static member of a class template, so that it is defined once even though this file is
+         * only made of headers.
+         */
+        template <typename = void>
+        struct ParseTables {
+            static constexpr ParseSuffixTable suffixes{};
+        };
+
+        template <typename D>
+        constexpr ParseSuffixTable ParseTables<D>::suffixes;
+
+        /**
+         * The bytes a unit symbol is made of: ASCII letters and digits, '_', '/', and every byte of a multi-byte UTF-8
+         * sequence (², ⁻, ¹...).
+         */
+        inline bool isSuffixCharacter(char c) {
+            unsigned char const u = static_cast<unsigned char>(c);
+            return (u >= 'a' && u <= 'z') || (u >= 'A' && u <= 'Z') || (u >= '0' && u <= '9') || u == '_' || u == '/' ||
+                   u >= 0x80;
+        }
+
+#ifdef __cpp_lib_to_chars
+        template <typename T>
+        ParseResult parseNumber(char const *first, char const *last, T &value) {
+            auto const result = std::from_chars(first, last, value);
+            return ParseResult{result.ptr, result.ec};
+        }
+#else
+        /**
+         * Without std::from_chars, the number is copied into a null-terminated buffer on the stack and read with
+         * std::strtod, which uses the decimal separator of the C locale in effect.
+         */
+        template <typename T>
+        ParseResult parseNumber(char const *first, char const *last, T &value) {
+            char buffer[64];
+            std::size_t length = 0;
+            while(first + length != last && length < sizeof(buffer) - 1 &&
+                  (isSuffixCharacter(first[length]) || first[length] == '.' || first[length] == '-' || first[length] == '+')) {
+                buffer[length] = first[length];
+                ++length;
+            }
+            buffer[length] = '\0';
+
+            // Same syntax as std::from_chars: no leading whitespace nor plus sign, and no hexadecimal number.
+            if(length == 0 || buffer[0] == '+' || std::strpbrk(buffer, "xX") != nullptr) {
+                return ParseResult{first, std::errc::invalid_argument};
+            }
+
+            char *end = buffer;
+            int const savedErrno = errno;
+            errno = 0;
+            T const parsed = std::is_same<T, long double>::value ? T(std::strtold(buffer, &end)) : T(std::strtod(buffer, &end));
+            bool const outOfRange = errno == ERANGE;
+            errno = savedErrno;
+            if(end == buffer) {
+                return ParseResult{first, std::errc::invalid_argument};
+            }
+            if(outOfRange) {
+                return ParseResult{first + (end - buffer), std::errc::result_out_of_range};
+            }
+            value = parsed;
+            return ParseResult{first + (end - buffer), std::errc()};
+        }
+#endif
+    }
+
+    /**
+     * Reads a quantity from the character buffer [first, last[, e.g. "12.5 cm" or "3ms", without any allocation nor
+     * stream: the number, written as std::from_chars accepts it, is followed by an optional run of spaces and by one of
+     * the symbols of the user-defined literals (mm, cm, km, g, kg, ns, us, ms, s, min, h, Hz, PI, deg, rad, mrad, PI_s,
+     * rad_s, deg_s, mm_s, m_s, mm2, m2...), or one of the symbols written by format_to() (m/s, m², s⁻¹...). The value
+     * goes through the same conversion as the matching literal.
+     * Dimensionless quantities, like Angle, may also be written without a symbol, in which case the number is the raw
+     * value (i.e. turns for an angle), as format_to() writes it.
+     * On success, value holds the quantity and the returned ptr points past the symbol. An unknown symbol, or one of
+     * another dimension than the quantity (e.g. "3 ms" read as a Length), gives std::errc::invalid_argument with ptr
+     * equal to first, and value is left untouched.
+     * The number is read with std::from_chars when the standard library provides it.
+     */
+    template <int Kg, int M, int S, typename T>
+    ParseResult parse(char const *first, char const *last, Unit<Kg, M, S, true, T> &value) {
+        using NumberType = CommonValueType<T, double>;
+
+        NumberType number;
+        ParseResult const numberResult = detail::parseNumber(first, last, number);
+        if(numberResult.ec != std::errc()) {
+            return numberResult;
+        }
+
+        char const *suffix = numberResult.ptr;
+        while(suffix != last && *suffix == ' ') {
+            ++suffix;
+        }
+        char const *suffixEnd = suffix;
+        while(suffixEnd != last && detail::isSuffixCharacter(*suffixEnd)) {
+            ++suffixEnd;
+        }
+
+        if(suffix == suffixEnd) {
+            if(Kg != 0 || M != 0 || S != 0) {
+                return ParseResult{first, std::errc::invalid_argument};
+            }
+            value = Unit<Kg, M, S, true, T>::makeFromValue(static_cast<T>(number));
+            return ParseResult{numberResult.ptr, std::errc()};
+        }
+
+        detail::ParseSuffix const *unit = detail::ParseTables<>::suffixes.find(suffix, std::size_t(suffixEnd - suffix));
+        if(unit == nullptr || unit->kg != Kg || unit->m != M || unit->s != S) {
+            return ParseResult{first, std::errc::invalid_argument};
+        }
+        value = Unit<Kg, M, S, true, T>::makeFromValue(
+            static_cast<T>(number * NumberType(unit->multiplier) / NumberType(unit->divisor)));
+        return ParseResult{suffixEnd, std::errc()};
+    }
+}
+
+#endif
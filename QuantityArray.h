@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  QuantityArray.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_QuantityArray_h
+#define Units_QuantityArray_h
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <utility>
+#include <vector>
+#include "Batch.h"
+#include "QuantitySpan.h"
+#include "Unit.h"
+
+namespace Units {
+
+    /**
+     * A standard allocator returning memory aligned on Alignment bytes, so that the contiguous storage of the
+     * quantity containers can be processed with aligned SIMD loads and stores.
+     */
+    template <typename T, std::size_t Alignment>
+    class AlignedAllocator {
+        static_assert(Alignment >= alignof(void *) && (Alignment & (Alignment - 1)) == 0,
+                      "The alignment must be a power of two, at least as large as the alignment of a pointer.");
+
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template <typename U>
+        AlignedAllocator(AlignedAllocator<U, Alignment> const &) noexcept {}
+
+        T *allocate(std::size_t n) {
+            if(n > (std::numeric_limits<std::size_t>::max() - Alignment - sizeof(void *)) / sizeof(T)) {
+                throw std::bad_alloc();
+            }
+
+            // The address returned by operator new is stored just before the aligned block, for deallocate().
+            void *raw = ::operator new(n * sizeof(T) + Alignment + sizeof(void *));
+            auto address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void *);
+            auto aligned = (address + Alignment - 1) & ~static_cast<std::uintptr_t>(Alignment - 1);
+            reinterpret_cast<void **>(aligned)[-1] = raw;
+
+            return reinterpret_cast<T *>(aligned);
+        }
+
+        void deallocate(T *p, std::size_t) noexcept {
+            ::operator delete(reinterpret_cast<void **>(p)[-1]);
+        }
+
+        template <typename U>
+        bool operator==(AlignedAllocator<U, Alignment> const &) const noexcept {
+            return true;
+        }
+
+        template <typename U>
+        bool operator!=(AlignedAllocator<U, Alignment> const &) const noexcept {
+            return false;
+        }
+    };
+
+    /**
+     * An owning, contiguous container of physical quantities of a same type.
+     * Only the raw numerical values are stored, in a memory block aligned for SIMD processing, while the dimension is
+     * kept in the type. The arithmetic operators apply element-wise and yield arrays of the coherent dimension, e.g.
+     * QuantityArray<Speed> * QuantityArray<Time> gives a QuantityArray<Length>.
+     *
+     * @param Q the type of the stored quantities (Length, Speed…).
+     */
+    template <typename Q>
+    class QuantityArray {
+        static_assert(is_unit_v<Q>, "A QuantityArray can only store physical quantities.");
+
+    public:
+        using QuantityType = Q;
+        using ValueType = typename Q::ValueType;
+
+        /**
+         * The alignment, in bytes, of the first stored value. Suitable for any SIMD instruction set up to AVX-512.
+         */
+        static constexpr std::size_t Alignment = 64;
+
+        using StorageType = std::vector<ValueType, AlignedAllocator<ValueType, Alignment>>;
+
+        /**
+         * An iterator over the quantities of the array, which are returned by value.
+         */
+        class ConstIterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = Q;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = Q;
+
+            Q operator*() const {
+                return Q::makeFromValue(*_value);
+            }
+
+            ConstIterator &operator++() {
+                ++_value;
+                return *this;
+            }
+
+            ConstIterator operator++(int) {
+                auto copy = *this;
+                ++_value;
+                return copy;
+            }
+
+            friend bool operator==(ConstIterator const &i1, ConstIterator const &i2) {
+                return i1._value == i2._value;
+            }
+
+            friend bool operator!=(ConstIterator const &i1, ConstIterator const &i2) {
+                return !(i1 == i2);
+            }
+
+        private:
+            friend class QuantityArray;
+            explicit ConstIterator(ValueType const *value) : _value(value) {}
+
+            ValueType const *_value;
+        };
+
+        /**
+         * Creates an empty array.
+         */
+        QuantityArray() = default;
+
+        /**
+         * Creates an array of size zero-valued quantities.
+         */
+        explicit QuantityArray(std::size_t size) : _values(size) {}
+
+        /**
+         * Creates an array of size copies of value.
+         */
+        QuantityArray(std::size_t size, Q const &value) : _values(size, value.toValue()) {}
+
+        /**
+         * Creates an array from a list of quantities: QuantityArray<Length>{1_m, 2_cm}.
+         */
+        QuantityArray(std::initializer_list<Q> values) {
+            _values.reserve(values.size());
+            for(auto const &q : values) {
+                _values.push_back(q.toValue());
+            }
+        }
+
+        std::size_t size() const {
+            return _values.size();
+        }
+
+        bool empty() const {
+            return _values.empty();
+        }
+
+        std::size_t capacity() const {
+            return _values.capacity();
+        }
+
+        void reserve(std::size_t capacity) {
+            _values.reserve(capacity);
+        }
+
+        /**
+         * Resizes the array, the new elements being zero-valued quantities.
+         */
+        void resize(std::size_t size) {
+            _values.resize(size);
+        }
+
+        void clear() {
+            _values.clear();
+        }
+
+        void push_back(Q const &q) {
+            _values.push_back(q.toValue());
+        }
+
+        Q operator[](std::size_t index) const {
+            return Q::makeFromValue(_values[index]);
+        }
+
+        /**
+         * Replaces the quantity at the given index.
+         */
+        void set(std::size_t index, Q const &q) {
+            _values[index] = q.toValue();
+        }
+
+        /**
+         * Accesses the raw values, as they would be returned by Q::toValue(). The pointer is aligned on Alignment bytes.
+         */
+        ValueType *data() {
+            return _values.data();
+        }
+
+        ValueType const *data() const {
+            return _values.data();
+        }
+
+        /**
+         * Returns a view over the whole array, e.g. to be given to the batch operations.
+         */
+        QuantitySpan<Q> span() {
+            return QuantitySpan<Q>(_values.data(), _values.size());
+        }
+
+        QuantitySpan<Q const> span() const {
+            return QuantitySpan<Q const>(_values.data(), _values.size());
+        }
+
+        ConstIterator begin() const {
+            return ConstIterator(_values.data());
+        }
+
+        ConstIterator end() const {
+            return ConstIterator(_values.data() + _values.size());
+        }
+
+        /**
+         * Adds the parameter, an array of same size and dimension, element-wise to the current instance.
+         */
+        QuantityArray &operator+=(QuantityArray const &a) {
+            Batch::add(this->span(), a.span(), this->span());
+            return *this;
+        }
+
+        /**
+         * Substracts the parameter, an array of same size and dimension, element-wise to the current instance.
+         */
+        QuantityArray &operator-=(QuantityArray const &a) {
+            Batch::subtract(this->span(), a.span(), this->span());
+            return *this;
+        }
+
+        /**
+         * Multiplies every element by a scalar value.
+         */
+        template <typename U>
+        std::enable_if_t<std::is_arithmetic<U>::value, QuantityArray &> operator*=(U v) {
+            this->scale<Batch::detail::Operation::Multiply>(v, std::is_same<CommonValueType<ValueType, U>, ValueType>());
+            return *this;
+        }
+
+        /**
+         * Divides every element by a scalar value.
+         */
+        template <typename U>
+        std::enable_if_t<std::is_arithmetic<U>::value, QuantityArray &> operator/=(U v) {
+            this->scale<Batch::detail::Operation::Divide>(v, std::is_same<CommonValueType<ValueType, U>, ValueType>());
+            return *this;
+        }
+
+    private:
+        /**
+         * The scalar converts to the representation without changing the result of the operation: the batch kernels
+         * apply.
+         */
+        template <Batch::detail::Operation Op, typename U>
+        void scale(U v, std::true_type) {
+            if(Op == Batch::detail::Operation::Multiply) {
+                Batch::multiply(this->span(), static_cast<ValueType>(v), this->span());
+            }
+            else {
+                Batch::divide(this->span(), static_cast<ValueType>(v), this->span());
+            }
+        }
+
+        /**
+         * The scalar is wider than the representation (e.g. an integral array times 0.5): like the operators of
+         * Unit, every element is computed in the common representation and converted back.
+         */
+        template <Batch::detail::Operation Op, typename U>
+        void scale(U v, std::false_type) {
+            for(auto &value : _values) {
+                Batch::detail::apply<Op>(value, CommonValueType<ValueType, U>(value), v);
+            }
+        }
+
+        StorageType _values;
+    };
+
+    template <typename Q>
+    constexpr std::size_t QuantityArray<Q>::Alignment;
+
+    /**
+     * Element-wise sum of two arrays of same size and dimension.
+     */
+    template <typename Q1, typename Q2, typename R = decltype(std::declval<Q1>() + std::declval<Q2>())>
+    QuantityArray<ArrayElementType_t<R>> operator+(QuantityArray<Q1> const &a1, QuantityArray<Q2> const &a2) {
+        QuantityArray<ArrayElementType_t<R>> result(a1.size());
+        Batch::add(a1.span(), a2.span(), result.span());
+        return result;
+    }
+
+    /**
+     * Element-wise difference of two arrays of same size and dimension.
+     */
+    template <typename Q1, typename Q2, typename R = decltype(std::declval<Q1>() - std::declval<Q2>())>
+    QuantityArray<ArrayElementType_t<R>> operator-(QuantityArray<Q1> const &a1, QuantityArray<Q2> const &a2) {
+        QuantityArray<ArrayElementType_t<R>> result(a1.size());
+        Batch::subtract(a1.span(), a2.span(), result.span());
+        return result;
+    }
+
+    /**
+     * Element-wise product of two arrays of same size. The dimension of the result is coherent, e.g.
+     * QuantityArray<Speed> * QuantityArray<Time> gives a QuantityArray<Length>.
+     */
+    template <typename Q1, typename Q2, typename R = decltype(std::declval<Q1>() * std::declval<Q2>())>
+    QuantityArray<ArrayElementType_t<R>> operator*(QuantityArray<Q1> const &a1, QuantityArray<Q2> const &a2) {
+        QuantityArray<ArrayElementType_t<R>> result(a1.size());
+        Batch::multiply(a1.span(), a2.span(), result.span());
+        return result;
+    }
+
+    /**
+     * Element-wise division of two arrays of same size. The dimension of the result is coherent, e.g.
+     * QuantityArray<Length> / QuantityArray<Time> gives a QuantityArray<Speed>.
+     */
+    template <typename Q1, typename Q2, typename R = decltype(std::declval<Q1>() / std::declval<Q2>())>
+    QuantityArray<ArrayElementType_t<R>> operator/(QuantityArray<Q1> const &a1, QuantityArray<Q2> const &a2) {
+        QuantityArray<ArrayElementType_t<R>> result(a1.size());
+        Batch::divide(a1.span(), a2.span(), result.span());
+        return result;
+    }
+
+    /**
+     * Multiplies every element of an array by a scalar or a quantity.
+     */
+    template <typename Q, typename V, typename = Batch::detail::EnableIfOperand<V>, typename R = decltype(std::declval<Q>() * std::declval<V>())>
+    QuantityArray<ArrayElementType_t<R>> operator*(QuantityArray<Q> const &a, V const &v) {
+        QuantityArray<ArrayElementType_t<R>> result(a.size());
+        Batch::multiply(a.span(), v, result.span());
+        return result;
+    }
+
+    template <typename V, typename Q, typename = Batch::detail::EnableIfOperand<V>, typename R = decltype(std::declval<V>() * std::declval<Q>())>
+    QuantityArray<ArrayElementType_t<R>> operator*(V const &v, QuantityArray<Q> const &a) {
+        return a * v;
+    }
+
+    /**
+     * Divides every element of an array by a scalar or a quantity.
+     */
+    template <typename Q, typename V, typename = Batch::detail::EnableIfOperand<V>, typename R = decltype(std::declval<Q>() / std::declval<V>())>
+    QuantityArray<ArrayElementType_t<R>> operator/(QuantityArray<Q> const &a, V const &v) {
+        QuantityArray<ArrayElementType_t<R>> result(a.size());
+        Batch::divide(a.span(), v, result.span());
+        return result;
+    }
+}
+
+#endif
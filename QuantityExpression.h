@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  QuantityExpression.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_QuantityExpression_h
+#define Units_QuantityExpression_h
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include "QuantityArray.h"
+#include "QuantitySpan.h"
+
+namespace Units {
+
+    /**
+     * Opt-in lazy evaluation of arithmetic over arrays of quantities.
+     * Wrapping an operand with lazy() turns the operators it takes part in into expression nodes instead of
+     * element-wise loops producing temporary arrays. The dimension of the whole expression is computed at compile time
+     * from the operators of Unit, and evaluate() computes it in a single loop, without any intermediate buffer:
+     *
+     *     QuantityArray<Length> x = evaluate(lazy(x0) + lazy(v) * lazy(t) + 0.5 * lazy(a) * lazy(t) * lazy(t));
+     *
+     * The nodes only reference the arrays they are built from, so an expression must be evaluated while its operands
+     * are still alive (typically within the same statement).
+     */
+    namespace Expressions {
+        struct ExpressionBase {};
+
+        template <typename T>
+        using is_expression = std::is_base_of<ExpressionBase, std::decay_t<T>>;
+
+        /**
+         * A leaf of an expression reading the elements of an array or a span.
+         */
+        template <typename Q>
+        class ArrayTerminal : public ExpressionBase {
+        public:
+            using QuantityType = Q;
+            static constexpr bool IsArray = true;
+
+            ArrayTerminal(typename Q::ValueType const *data, std::size_t size) : _data(data), _size(size) {}
+
+            std::size_t size() const {
+                return _size;
+            }
+
+            typename Q::ValueType operator[](std::size_t index) const {
+                return _data[index];
+            }
+
+        private:
+            typename Q::ValueType const *_data;
+            std::size_t _size;
+        };
+
+        /**
+         * A leaf of an expression broadcasting a single scalar or quantity to every element.
+         */
+        template <typename V>
+        class ScalarTerminal : public ExpressionBase {
+        public:
+            using QuantityType = V;
+            static constexpr bool IsArray = false;
+
+            explicit ScalarTerminal(V const &v) : _value(raw(v)) {}
+
+            std::size_t size() const {
+                return std::numeric_limits<std::size_t>::max();
+            }
+
+            auto operator[](std::size_t) const {
+                return _value;
+            }
+
+        private:
+            template <typename T>
+            static std::enable_if_t<!is_unit_v<T>, T> raw(T const &v) {
+                return v;
+            }
+
+            template <typename T>
+            static std::enable_if_t<is_unit_v<T>, typename T::ValueType> raw(T const &v) {
+                return v.toValue();
+            }
+
+            decltype(raw(std::declval<V>())) _value;
+        };
+
+        enum class Operation { Add, Subtract, Multiply, Divide };
+
+        /**
+         * The type of the result of an operator applied to two quantities or scalars, as given by the operators of
+         * Unit.
+         */
+        template <Operation Op, typename L, typename R>
+        struct ResultType;
+
+        template <typename L, typename R>
+        struct ResultType<Operation::Add, L, R> {
+            using type = decltype(std::declval<L>() + std::declval<R>());
+        };
+
+        template <typename L, typename R>
+        struct ResultType<Operation::Subtract, L, R> {
+            using type = decltype(std::declval<L>() - std::declval<R>());
+        };
+
+        template <typename L, typename R>
+        struct ResultType<Operation::Multiply, L, R> {
+            using type = decltype(std::declval<L>() * std::declval<R>());
+        };
+
+        template <typename L, typename R>
+        struct ResultType<Operation::Divide, L, R> {
+            using type = decltype(std::declval<L>() / std::declval<R>());
+        };
+
+        /**
+         * An inner node of an expression, applying an arithmetic operator to two sub-expressions.
+         */
+        template <Operation Op, typename L, typename R>
+        class BinaryExpression : public ExpressionBase {
+        public:
+            using QuantityType = typename ResultType<Op, typename L::QuantityType, typename R::QuantityType>::type;
+            static constexpr bool IsArray = L::IsArray || R::IsArray;
+
+            BinaryExpression(L const &l, R const &r) : _l(l), _r(r) {
+                assert(!L::IsArray || !R::IsArray || l.size() == r.size());
+            }
+
+            std::size_t size() const {
+                return L::IsArray ? _l.size() : _r.size();
+            }
+
+            auto operator[](std::size_t index) const {
+                switch(Op) {
+                    case Operation::Add:
+                        return _l[index] + _r[index];
+                    case Operation::Subtract:
+                        return _l[index] - _r[index];
+                    case Operation::Multiply:
+                        return _l[index] * _r[index];
+                    case Operation::Divide:
+                        break;
+                }
+                return _l[index] / _r[index];
+            }
+
+        private:
+            L _l;
+            R _r;
+        };
+
+        /**
+         * Maps an operand of an expression operator to the node it is stored as.
+         */
+        template <typename T, typename = void>
+        struct Terminal {};
+
+        template <typename T>
+        struct Terminal<T, std::enable_if_t<is_expression<T>::value>> {
+            using type = std::decay_t<T>;
+            static type make(T const &t) {
+                return t;
+            }
+        };
+
+        template <typename T>
+        struct Terminal<T, std::enable_if_t<is_unit_v<T> || std::is_arithmetic<T>::value>> {
+            using type = ScalarTerminal<T>;
+            static type make(T const &t) {
+                return type(t);
+            }
+        };
+
+        template <typename Q>
+        struct Terminal<QuantityArray<Q>> {
+            using type = ArrayTerminal<Q>;
+            static type make(QuantityArray<Q> const &a) {
+                return type(a.data(), a.size());
+            }
+        };
+
+        template <typename Q>
+        struct Terminal<QuantitySpan<Q>> {
+            using type = ArrayTerminal<std::remove_const_t<Q>>;
+            static type make(QuantitySpan<Q> const &s) {
+                return type(s.data(), s.size());
+            }
+        };
+
+        template <typename T>
+        using TerminalType = typename Terminal<std::decay_t<T>>::type;
+
+        template <Operation Op, typename L, typename R>
+        using EnableIfExpression = std::enable_if_t<(is_expression<L>::value || is_expression<R>::value),
+                                                    BinaryExpression<Op, TerminalType<L>, TerminalType<R>>>;
+
+        template <Operation Op, typename L, typename R>
+        BinaryExpression<Op, TerminalType<L>, TerminalType<R>> makeBinary(L const &l, R const &r) {
+            return {Terminal<std::decay_t<L>>::make(l), Terminal<std::decay_t<R>>::make(r)};
+        }
+
+        template <typename L, typename R>
+        EnableIfExpression<Operation::Add, L, R> operator+(L const &l, R const &r) {
+            return makeBinary<Operation::Add>(l, r);
+        }
+
+        template <typename L, typename R>
+        EnableIfExpression<Operation::Subtract, L, R> operator-(L const &l, R const &r) {
+            return makeBinary<Operation::Subtract>(l, r);
+        }
+
+        template <typename L, typename R>
+        EnableIfExpression<Operation::Multiply, L, R> operator*(L const &l, R const &r) {
+            return makeBinary<Operation::Multiply>(l, r);
+        }
+
+        template <typename L, typename R>
+        EnableIfExpression<Operation::Divide, L, R> operator/(L const &l, R const &r) {
+            return makeBinary<Operation::Divide>(l, r);
+        }
+    }
+
+    /**
+     * Starts a lazy expression from an array of quantities.
+     */
+    template <typename Q>
+    Expressions::ArrayTerminal<Q> lazy(QuantityArray<Q> const &a) {
+        return Expressions::ArrayTerminal<Q>(a.data(), a.size());
+    }
+
+    /**
+     * Starts a lazy expression from a span of quantities.
+     */
+    template <typename Q>
+    Expressions::ArrayTerminal<std::remove_const_t<Q>> lazy(QuantitySpan<Q> const &s) {
+        return Expressions::ArrayTerminal<std::remove_const_t<Q>>(s.data(), s.size());
+    }
+
+    /**
+     * The type of quantity an expression evaluates to.
+     */
+    template <typename E>
+    using ExpressionQuantityType = ArrayElementType_t<typename E::QuantityType>;
+
+    /**
+     * Evaluates an expression into an existing span, whose dimension must match the one of the expression.
+     * The output may be one of the arrays the expression reads, as each element is only read before being written.
+     */
+    template <typename E, typename Q>
+    std::enable_if_t<Expressions::is_expression<E>::value> evaluate(E const &e, QuantitySpan<Q> const &out) {
+        static_assert(std::is_same<Q, ExpressionQuantityType<E>>::value,
+                      "The output span does not have the dimension or representation of the expression.");
+        static_assert(E::IsArray, "The expression does not reference any array.");
+        assert(e.size() == out.size());
+
+        auto data = out.data();
+        for(std::size_t i = 0; i < out.size(); ++i) {
+            data[i] = e[i];
+        }
+    }
+
+    /**
+     * Evaluates an expression into a new array, in a single pass.
+     */
+    template <typename E>
+    std::enable_if_t<Expressions::is_expression<E>::value, QuantityArray<ExpressionQuantityType<E>>> evaluate(E const &e) {
+        QuantityArray<ExpressionQuantityType<E>> result(e.size());
+        evaluate(e, result.span());
+        return result;
+    }
+}
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  QuantitySpan.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_QuantitySpan_h
+#define Units_QuantitySpan_h
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include "Unit.h"
+
+namespace Units {
+
+    /**
+     * The quantity type stored in an array or a span resulting from an element-wise operation: the result of a division of
+     * two quantities of the same dimension is a scalar, which is stored as a dimensionless quantity.
+     */
+    template <typename R, bool = is_unit_v<R>>
+    struct ArrayElementType {
+        using type = R;
+    };
+
+    template <typename R>
+    struct ArrayElementType<R, false> {
+        using type = Unit<0, 0, 0, true, R>;
+    };
+
+    template <typename R>
+    using ArrayElementType_t = typename ArrayElementType<R>::type;
+
+    /**
+     * A non-owning view over a contiguous sequence of raw quantity values, such as the storage of a QuantityArray.
+     * The dimension is kept in the type, so that the batch operations on spans are checked at compile time just like
+     * the operators of Unit.
+     *
+     * @param Q the type of the viewed quantities. A const-qualified type (e.g. QuantitySpan<Length const>) gives a
+     * read-only view.
+     */
+    template <typename Q>
+    class QuantitySpan {
+    public:
+        using QuantityType = std::remove_const_t<Q>;
+        using ValueType = std::conditional_t<std::is_const<Q>::value,
+                                             typename QuantityType::ValueType const,
+                                             typename QuantityType::ValueType>;
+
+        static_assert(is_unit_v<QuantityType>, "A QuantitySpan can only view physical quantities.");
+
+        /**
+         * Creates an empty span.
+         */
+        constexpr QuantitySpan() = default;
+
+        /**
+         * Creates a span over size raw values, as they would be returned by QuantityType::toValue().
+         */
+        constexpr QuantitySpan(ValueType *data, std::size_t size) : _data(data), _size(size) {}
+
+        /**
+         * Creates a span over a container of raw values storing the same type of quantity, e.g. a QuantityArray.
+         */
+        template <typename Container,
+                  typename = std::enable_if_t<std::is_same<typename std::remove_const_t<Container>::QuantityType, QuantityType>::value>,
+                  typename = std::enable_if_t<std::is_convertible<decltype(std::declval<Container &>().data()), ValueType *>::value>>
+        constexpr QuantitySpan(Container &c) : QuantitySpan(c.data(), c.size()) {}
+
+        /**
+         * A mutable span converts to a read-only one.
+         */
+        template <typename U, typename = std::enable_if_t<std::is_same<U const, Q>::value && !std::is_const<U>::value>>
+        constexpr QuantitySpan(QuantitySpan<U> const &s) : QuantitySpan(s.data(), s.size()) {}
+
+        constexpr std::size_t size() const {
+            return _size;
+        }
+
+        constexpr bool empty() const {
+            return _size == 0;
+        }
+
+        constexpr ValueType *data() const {
+            return _data;
+        }
+
+        constexpr QuantityType operator[](std::size_t index) const {
+            return QuantityType::makeFromValue(_data[index]);
+        }
+
+        /**
+         * Returns the span of count elements starting at offset.
+         */
+        constexpr QuantitySpan subspan(std::size_t offset, std::size_t count) const {
+            assert(offset + count <= _size);
+            return QuantitySpan(_data + offset, count);
+        }
+
+    private:
+        ValueType *_data = nullptr;
+        std::size_t _size = 0;
+    };
+}
+
+#endif
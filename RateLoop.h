@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  RateLoop.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_RateLoop_h
+#define Units_RateLoop_h
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include "ExactDuration.h"
+#include "Frequency.h"
+#include "Time.h"
+#include "TimePoint.h"
+
+namespace Units {
+
+    /**
+     * What a RateLoop does when an iteration ends after the deadline of the next one.
+     */
+    enum class OverrunPolicy {
+        /**
+         * Skips the missed periods, and waits for the next deadline of the schedule.
+         */
+        Skip,
+        /**
+         * Runs the missed iterations back to back, without waiting, until the loop is back on schedule.
+         */
+        CatchUp,
+        /**
+         * Runs the late iteration immediately, and shifts the rest of the schedule by the delay.
+         */
+        Stretch,
+    };
+
+    /**
+     * Runs a loop at a fixed rate: wait() returns at the deadline of each iteration, the deadlines being computed
+     * from the start of the loop (start + n / rate), so that neither the duration of the iterations nor the rounding
+     * of the period make the loop drift.
+     * The wake-ups are done by a BasicPreciseSleeper, which sleeps until a spin slice before each deadline (100
+     * microseconds by default) and busy-waits for the rest: a null slice saves the core, but leaves the jitter to the
+     * wake-up latency of the scheduler, typically 50 to 100 microseconds on Linux. The delays of the wake-ups after the
+     * deadlines are the jitter statistics of the loop. An iteration that ends after the next deadline
+     * is an overrun, handled according to the OverrunPolicy.
+     * An instance is meant to be used by one thread at a time.
+     *
+     * @code
+     * RateLoop loop(1_Hz * 1000);
+     * for(;;) {
+     *     loop.wait();
+     *     control();
+     * }
+     * @endcode
+     */
+    template <typename ClockPolicy>
+    class BasicRateLoop {
+    public:
+        using TimePointType = BasicTimePoint<ClockPolicy>;
+
+        /**
+         * Creates a loop running at the given rate, which must be positive, and starting now.
+         */
+        explicit BasicRateLoop(Frequency const &rate, OverrunPolicy overrunPolicy = OverrunPolicy::Skip,
+                               Duration const &spinSlice = Duration::makeFromUs(100))
+                : _periodNs(1e9L / rate.toHz()), _overrunPolicy(overrunPolicy), _sleeper(spinSlice) {
+            assert(rate.toHz() > 0);
+            this->restart();
+        }
+
+        Duration period() const {
+            return Duration::makeFromNs(_periodNs);
+        }
+
+        OverrunPolicy overrunPolicy() const {
+            return _overrunPolicy;
+        }
+
+        void setOverrunPolicy(OverrunPolicy overrunPolicy) {
+            _overrunPolicy = overrunPolicy;
+        }
+
+        /**
+         * Restarts the schedule from now, the first deadline being one period later.
+         */
+        void restart() {
+            _start = TimePointType::now();
+            _tick = 0;
+        }
+
+        /**
+         * Waits for the deadline of the next iteration, and returns it. In case of overrun, it returns the deadline
+         * of the iteration to run according to the OverrunPolicy, which may be in the past.
+         */
+        TimePointType wait() {
+            ++_iterations;
+            TimePointType deadline = this->deadlineOf(++_tick);
+            TimePointType const now = TimePointType::now();
+            ExactDuration const late = exactDifference(now, deadline);
+            if(late > ExactDuration()) {
+                this->recordOverrun(late);
+                switch(_overrunPolicy) {
+                    case OverrunPolicy::Skip: {
+                        std::uint64_t const tick = _tick;
+                        _tick += std::uint64_t(late.toNs() / _periodNs);
+                        while(this->deadlineOf(_tick) <= now) {
+                            ++_tick;
+                        }
+                        _skippedTicks += _tick - tick;
+                        deadline = this->deadlineOf(_tick);
+                        break;
+                    }
+                    case OverrunPolicy::CatchUp:
+                        return deadline;
+                    case OverrunPolicy::Stretch:
+                        _start = now;
+                        _tick = 0;
+                        return now;
+                }
+            }
+            _sleeper.sleepUntil(deadline);
+            return deadline;
+        }
+
+        /**
+         * The number of calls to wait().
+         */
+        std::uint64_t iterations() const {
+            return _iterations;
+        }
+
+        /**
+         * The number of iterations which ended after the next deadline.
+         */
+        std::uint64_t overruns() const {
+            return _overruns;
+        }
+
+        /**
+         * The number of periods skipped with OverrunPolicy::Skip.
+         */
+        std::uint64_t skippedTicks() const {
+            return _skippedTicks;
+        }
+
+        /**
+         * The delay by which the last overrun missed its deadline.
+         */
+        Duration lastOverrun() const {
+            return _lastOverrun.toTime();
+        }
+
+        Duration maxOverrun() const {
+            return _maxOverrun.toTime();
+        }
+
+        /**
+         * The delay of the last wake-up after its deadline.
+         */
+        Duration lastJitter() const {
+            return _sleeper.lastOvershoot();
+        }
+
+        Duration maxJitter() const {
+            return _sleeper.maxOvershoot();
+        }
+
+        Duration meanJitter() const {
+            return _sleeper.meanOvershoot();
+        }
+
+        void resetStatistics() {
+            _iterations = _overruns = _skippedTicks = 0;
+            _lastOverrun = _maxOverrun = ExactDuration();
+            _sleeper.resetStatistics();
+        }
+
+    private:
+        TimePointType deadlineOf(std::uint64_t tick) const {
+            return _start + ExactDuration::makeFromNs(ExactDuration::ValueType(std::llround(tick * _periodNs)));
+        }
+
+        void recordOverrun(ExactDuration const &late) {
+            ++_overruns;
+            _lastOverrun = late;
+            if(late > _maxOverrun) {
+                _maxOverrun = late;
+            }
+        }
+
+        long double _periodNs;
+        OverrunPolicy _overrunPolicy;
+        BasicPreciseSleeper<ClockPolicy> _sleeper;
+        TimePointType _start;
+        std::uint64_t _tick = 0;
+        std::uint64_t _iterations = 0;
+        std::uint64_t _overruns = 0;
+        std::uint64_t _skippedTicks = 0;
+        ExactDuration _lastOverrun;
+        ExactDuration _maxOverrun;
+    };
+
+    using RateLoop = BasicRateLoop<ClockPolicy::UNITS_DEFAULT_CLOCK_POLICY>;
+}
+
+#endif
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  SimulatedClock.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_SimulatedClock_h
+#define Units_SimulatedClock_h
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+#include "ClockPolicy.h"
+#include "ExactDuration.h"
+
+namespace Units {
+    namespace ClockPolicy {
+
+        /**
+         * A virtual clock for tests and simulations, which only moves forward when the threads using it sleep: a
+         * sleep does not wait for real time to pass, but for every other simulated thread to sleep as well, after which
+         * the clock jumps to the earliest deadline and wakes its sleeper.
+         * The simulated threads are started with spawn(). A thread that calls spawn(), sleeps on the clock, or holds a
+         * Participant takes part in the simulation as well, until it exits. The simulated threads run one at a time:
+         * a thread is woken only when all the others sleep, in the order of the deadlines, then in the order the sleeps
+         * were requested (in the order of spawn() for the start of the threads), and the clock stays at its deadline
+         * until it sleeps again. A simulation thus runs in a deterministic order, as fast as the threads compute.
+         * As the clock waits for them, the simulated threads must not block on each other by other means than the
+         * clock, e.g. they must be joined with Thread::join(), which sleeps until the joined thread ends.
+         * Use it as the clock of TimePoint and Units::sleep by defining UNITS_DEFAULT_CLOCK_POLICY to Simulated and
+         * including this file before TimePoint.h, or through SimulatedTimePoint.
+         */
+        class Simulated {
+            struct End;
+
+        public:
+            /**
+             * The virtual time in nanoseconds, starting at 0 (see reset()).
+             */
+            using TimePointType = std::int64_t;
+
+            static TimePointType now() noexcept {
+                return state().now.load(std::memory_order_acquire);
+            }
+
+            static ExactDuration difference(TimePointType const &t1, TimePointType const &t2) {
+                return ExactDuration::makeFromNs(t1 - t2);
+            }
+
+            static TimePointType advance(TimePointType const &t, ExactDuration const &d) {
+                return t + d.toNs();
+            }
+
+            /**
+             * Sleeps until the virtual time reaches now() + d. A null or negative delay lets the other threads due at
+             * the same time run first.
+             */
+            static void sleep(ExactDuration const &d) {
+                State &s = state();
+                std::unique_lock<std::mutex> lock(s.mutex);
+                Sleeper sleeper{advance(s.now.load(std::memory_order_relaxed), d), s.nextOrder++};
+                park(lock, sleeper);
+            }
+
+            /**
+             * Sleeps until the virtual time reaches t.
+             */
+            static void sleepUntil(TimePointType t) {
+                State &s = state();
+                std::unique_lock<std::mutex> lock(s.mutex);
+                Sleeper sleeper{t, s.nextOrder++};
+                park(lock, sleeper);
+            }
+
+            /**
+             * Sets the virtual time, e.g. between two simulations. No thread must be sleeping.
+             */
+            static void reset(TimePointType t = 0) {
+                State &s = state();
+                std::lock_guard<std::mutex> lock(s.mutex);
+                s.now.store(t, std::memory_order_release);
+            }
+
+            /**
+             * Makes the current thread a simulated thread for the lifetime of the object, unless it already is one:
+             * the virtual time does not move forward while it runs.
+             */
+            class Participant {
+            public:
+                Participant() {
+                    State &s = state();
+                    std::lock_guard<std::mutex> lock(s.mutex);
+                    if(membership().depth++ == 0) {
+                        ++s.running;
+                    }
+                }
+
+                Participant(Participant const &) = delete;
+                Participant &operator=(Participant const &) = delete;
+
+                ~Participant() {
+                    State &s = state();
+                    std::lock_guard<std::mutex> lock(s.mutex);
+                    if(--membership().depth == 0) {
+                        --s.running;
+                        dispatch(s);
+                    }
+                }
+            };
+
+            /**
+             * A thread started by spawn(), joined on destruction if it has not been. Joining it from a simulated thread
+             * lets the virtual time move forward until the joined thread ends.
+             */
+            class Thread {
+            public:
+                Thread() = default;
+                Thread(Thread &&) = default;
+
+                Thread &operator=(Thread &&t) {
+                    if(_thread.joinable()) {
+                        join();
+                    }
+                    _thread = std::move(t._thread);
+                    _end = std::move(t._end);
+                    return *this;
+                }
+
+                ~Thread() {
+                    if(_thread.joinable()) {
+                        join();
+                    }
+                }
+
+                bool joinable() const {
+                    return _thread.joinable();
+                }
+
+                /**
+                 * Waits for the thread to end. The calling thread, if simulated, sleeps meanwhile: the joined thread
+                 * wakes it on its end, at the virtual time of its end, after the threads already due at that time.
+                 */
+                void join() {
+                    if(_end != nullptr && membership().depth > 0) {
+                        State &s = state();
+                        std::unique_lock<std::mutex> lock(s.mutex);
+                        if(!_end->ended) {
+                            // The deadline and the order of the sleeper are set by the end of the joined thread.
+                            Sleeper sleeper{0, 0};
+                            _end->joiner = &sleeper;
+                            --s.running;
+                            wait(lock, sleeper);
+                        }
+                    }
+                    // The joined thread does not use the clock anymore: the virtual time does not depend on how long it
+                    // takes to exit.
+                    _thread.join();
+                }
+
+            private:
+                friend class Simulated;
+
+                Thread(std::thread &&thread, std::shared_ptr<End> end)
+                        : _thread(std::move(thread)), _end(std::move(end)) {}
+
+                std::thread _thread;
+                std::shared_ptr<End> _end;
+            };
+
+            /**
+             * Starts a simulated thread running f(). The threads started at the same virtual time run in the order
+             * they were spawned, each one once the previous one sleeps or ends.
+             */
+            template <typename F>
+            static Thread spawn(F f) {
+                State &s = state();
+                TimePointType start;
+                std::uint64_t order;
+                {
+                    std::lock_guard<std::mutex> lock(s.mutex);
+                    // The spawning thread becomes a simulated thread, so that the virtual time does not move forward
+                    // before it sleeps.
+                    Membership &m = membership();
+                    if(m.depth == 0) {
+                        m.depth = 1;
+                        ++s.running;
+                    }
+                    ++s.running;
+                    start = s.now.load(std::memory_order_relaxed);
+                    order = s.nextOrder++;
+                }
+                auto end = std::make_shared<End>();
+                std::thread thread([f = std::move(f), start, order, end]() mutable {
+                    // Takes over the count of the thread as running by spawn(), until the end of the thread, which
+                    // Membership reports to the joining thread.
+                    Membership &m = membership();
+                    m.depth = 1;
+                    m.end = std::move(end);
+                    {
+                        State &shared = state();
+                        std::unique_lock<std::mutex> lock(shared.mutex);
+                        --shared.running;
+                        Sleeper sleeper{start, order};
+                        shared.sleepers.insert(&sleeper);
+                        wait(lock, sleeper);
+                    }
+                    f();
+                });
+                return Thread(std::move(thread), std::move(end));
+            }
+
+        private:
+            struct Sleeper {
+                TimePointType deadline;
+                std::uint64_t order;
+                bool awake = false;
+            };
+
+            struct Earlier {
+                bool operator()(Sleeper const *s1, Sleeper const *s2) const {
+                    return s1->deadline < s2->deadline || (s1->deadline == s2->deadline && s1->order < s2->order);
+                }
+            };
+
+            struct State {
+                std::mutex mutex;
+                std::condition_variable wakeUp;
+                std::atomic<TimePointType> now{0};
+                std::set<Sleeper *, Earlier> sleepers;
+                std::size_t running = 0;
+                std::uint64_t nextOrder = 0;
+            };
+
+            /**
+             * The end of a thread started by spawn(), shared with its Thread. Guarded by the mutex of the state.
+             */
+            struct End {
+                bool ended = false;
+                Sleeper *joiner = nullptr;
+            };
+
+            /**
+             * Whether the current thread is a simulated thread, counted in State::running unless it sleeps. It stays
+             * one until it exits once it has slept on the clock.
+             */
+            struct Membership {
+                int depth = 0;
+                std::shared_ptr<End> end;
+
+                ~Membership() {
+                    if(depth > 0) {
+                        State &s = state();
+                        std::lock_guard<std::mutex> lock(s.mutex);
+                        if(end != nullptr) {
+                            // Wakes the joining thread, if any, like a sleep until the current time would.
+                            end->ended = true;
+                            if(end->joiner != nullptr) {
+                                end->joiner->deadline = s.now.load(std::memory_order_relaxed);
+                                end->joiner->order = s.nextOrder++;
+                                s.sleepers.insert(end->joiner);
+                            }
+                        }
+                        depth = 0;
+                        --s.running;
+                        dispatch(s);
+                    }
+                }
+            };
+
+            static State &state() {
+                static State s;
+                return s;
+            }
+
+            static Membership &membership() {
+                thread_local Membership m;
+                return m;
+            }
+
+            /**
+             * Puts the calling thread to sleep until dispatch() wakes it, making it a simulated thread if it is not
+             * one. The lock of the state must be held.
+             */
+            static void park(std::unique_lock<std::mutex> &lock, Sleeper &sleeper) {
+                State &s = state();
+                Membership &m = membership();
+                if(m.depth == 0) {
+                    m.depth = 1;
+                } else {
+                    --s.running;
+                }
+                s.sleepers.insert(&sleeper);
+                wait(lock, sleeper);
+            }
+
+            /**
+             * Waits for dispatch() to wake a simulated thread no longer counted as running, whose sleeper is or will be
+             * in the sleepers. The lock of the state must be held.
+             */
+            static void wait(std::unique_lock<std::mutex> &lock, Sleeper &sleeper) {
+                State &s = state();
+                dispatch(s);
+                s.wakeUp.wait(lock, [&sleeper] { return sleeper.awake; });
+            }
+
+            /**
+             * Wakes the earliest sleeper once no simulated thread runs, and counts it as running. The lock of the
+             * state must be held.
+             */
+            static void dispatch(State &s) {
+                if(s.running != 0 || s.sleepers.empty()) {
+                    return;
+                }
+                Sleeper *sleeper = *s.sleepers.begin();
+                s.sleepers.erase(s.sleepers.begin());
+                if(sleeper->deadline > s.now.load(std::memory_order_relaxed)) {
+                    s.now.store(sleeper->deadline, std::memory_order_release);
+                }
+                sleeper->awake = true;
+                ++s.running;
+                s.wakeUp.notify_all();
+            }
+        };
+    }
+}
+
+// Included once the policy is defined, so that it can be the clock of TimePoint (see UNITS_DEFAULT_CLOCK_POLICY).
+#include "TimePoint.h"
+
+namespace Units {
+    using SimulatedTimePoint = BasicTimePoint<ClockPolicy::Simulated>;
+}
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  SimulatedClockTests.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_SimulatedClockTests_h
+#define Units_SimulatedClockTests_h
+
+/**
+ * Define UNITS_TESTS before including this file to get checkSimulatedClock(), a run-time test of the order in which
+ * ClockPolicy::Simulated runs its threads.
+ */
+#ifdef UNITS_TESTS
+
+#include <vector>
+#include "ExactDuration.h"
+#include "SimulatedClock.h"
+
+namespace Units {
+    namespace UnitsTests {
+        /**
+         * Checks that the virtual time seen by a thread after its sleeps and its joins does not depend on the
+         * scheduling of the threads, by running the same simulation several times. The calling thread becomes a
+         * simulated thread (see ClockPolicy::Simulated).
+         */
+        inline bool checkSimulatedClock() {
+            using Clock = ClockPolicy::Simulated;
+            bool ok = true;
+            for(int run = 0; run < 20 && ok; ++run) {
+                // Written by one simulated thread at a time.
+                std::vector<int> log;
+                Clock::TimePointType const start = Clock::now();
+                auto elapsed = [start] { return Clock::difference(Clock::now(), start); };
+
+                Clock::Thread a = Clock::spawn([&log] {
+                    for(int i = 0; i < 1000; ++i) {
+                        log.push_back(0);
+                        Clock::sleep(ExactDuration::makeFromNs(20));
+                    }
+                });
+                Clock::Thread b = Clock::spawn([&log] {
+                    Clock::sleep(ExactDuration::makeFromNs(10));
+                    log.push_back(1);
+                });
+
+                Clock::sleep(ExactDuration::makeFromNs(5));
+                ok = ok && elapsed() == ExactDuration::makeFromNs(5) && log == std::vector<int>{0};
+                b.join();
+                ok = ok && elapsed() == ExactDuration::makeFromNs(10) && log == std::vector<int>{0, 1};
+                a.join();
+                ok = ok && elapsed() == ExactDuration::makeFromNs(20000) && log.size() == 1001;
+            }
+            return ok;
+        }
+    }
+}
+
+#endif
+
+#endif
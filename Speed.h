@@ -33,20 +33,22 @@
 
 namespace Units {
 
+    template <typename T>
+    using BasicSpeed = Unit<0, 1, -1, true, T>;
     using Speed = Unit<0, 1, -1, true>;
 
     /**
      * Class representing a speed quantity.
      */
-    template <>
-    class Unit<0, 1, -1, true> : public Unit<0, 1, -1, false> {
-        friend class Unit<0, 1, -1, false>;
+    template <typename T>
+    class Unit<0, 1, -1, true, T> : public Unit<0, 1, -1, false, T> {
+        friend class Unit<0, 1, -1, false, T>;
 
     public:
-        using Unit<0, 1, -1, false>::ValueType;
-        using Type = Unit<0, 1, -1, true>;
+        using typename Unit<0, 1, -1, false, T>::ValueType;
+        using Type = Unit<0, 1, -1, true, T>;
 
-        friend std::ostream &operator<<(std::ostream &s, Type const &v);
+        friend std::ostream &operator<<(std::ostream &s, Speed const &v);
 
         /**
          * Returns a new speed from the value specified in metres per second.
@@ -79,29 +81,29 @@ namespace Units {
         /**
          * Returns the value of the speed in millimetres per second.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toMm_s() const {
-            return (*this * 1000).value<Rep>();
+            return (*this * 1000).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the speed in metres per second.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toM_s() const {
-            return (*this).value<Rep>();
+            return (*this).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the length in decimillimetres per second.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toDm_s() const {
-            return (*this * 10).value<Rep>();
+            return (*this * 10).template value<Rep, Policy>();
         }
 
     private:
-        using Unit<0, 1, -1, false>::Unit;
+        using Unit<0, 1, -1, false, T>::Unit;
     };
 
     namespace UnitsLiterals {
@@ -32,20 +32,22 @@
 #include "Unit.h"
 
 namespace Units {
+    template <typename T>
+    using BasicSurface = Unit<0, 2, 0, true, T>;
     using Surface = Unit<0, 2, 0, true>;
 
     /**
      * Class representing a surface/area quantity.
      */
-    template <>
-    class Unit<0, 2, 0, true> : public Unit<0, 2, 0, false> {
-        friend class Unit<0, 2, 0, false>;
+    template <typename T>
+    class Unit<0, 2, 0, true, T> : public Unit<0, 2, 0, false, T> {
+        friend class Unit<0, 2, 0, false, T>;
 
     public:
-        using Unit<0, 2, 0, false>::ValueType;
-        using Type = Unit<0, 2, 0, true>;
+        using typename Unit<0, 2, 0, false, T>::ValueType;
+        using Type = Unit<0, 2, 0, true, T>;
 
-        friend std::ostream &operator<<(std::ostream &stream, Type const &v);
+        friend std::ostream &operator<<(std::ostream &stream, Surface const &v);
 
         /**
          * Returns a new surface/area from the value specified in squared millimetres.
@@ -78,21 +80,21 @@ namespace Units {
         /**
          * Returns the value of the surface/area in squared metres.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toM2() const {
-            return (*this).value<Rep>();
+            return (*this).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the surface/area in squared millimetres.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toMm2() const {
-            return (*this * 1000000).value<Rep>();
+            return (*this * 1000000).template value<Rep, Policy>();
         }
 
     private:
-        using Unit<0, 2, 0, false>::Unit;
+        using Unit<0, 2, 0, false, T>::Unit;
     };
 
     namespace UnitsLiterals {
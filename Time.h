@@ -34,21 +34,23 @@
 
 namespace Units {
 
+    template <typename T>
+    using BasicTime = Unit<0, 0, 1, true, T>;
     using Time = Unit<0, 0, 1, true>;
     using Duration = Time;
 
     /**
      * Class representing a time/duration quantity.
      */
-    template <>
-    class Unit<0, 0, 1, true> : public Unit<0, 0, 1, false> {
-        friend class Unit<0, 0, 1, false>;
+    template <typename T>
+    class Unit<0, 0, 1, true, T> : public Unit<0, 0, 1, false, T> {
+        friend class Unit<0, 0, 1, false, T>;
 
     public:
-        using Unit<0, 0, 1, false>::ValueType;
-        using Type = Unit<0, 0, 1, true>;
+        using typename Unit<0, 0, 1, false, T>::ValueType;
+        using Type = Unit<0, 0, 1, true, T>;
 
-        friend std::ostream &operator<<(std::ostream &s, Type const &d);
+        friend std::ostream &operator<<(std::ostream &s, Time const &d);
 
         /**
          * Returns a new time/duration from the value specified in nanoseconds.
@@ -81,25 +83,25 @@ namespace Units {
         /**
          * Returns a new time/duration from the specified std::chrono::duration.
          */
-        template <typename T>
-        static constexpr Type makeFromSystemDelay(T const &delay) {
+        template <typename D>
+        static constexpr Type makeFromSystemDelay(D const &delay) {
             return makeFromNs(std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count());
         }
 
         /**
          * Returns the value of the time/duration in seconds.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toS() const {
-            return (*this).value<Rep>();
+            return (*this).template value<Rep, Policy>();
         }
 
         /**
          * Returns the value of the time/duration in milliseconds.
          */
-        template <typename Rep = ValueType>
+        template <typename Rep = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr Rep toMs() const {
-            return (*this * 1000).value<Rep>();
+            return (*this * 1000).template value<Rep, Policy>();
         }
 
         /**
@@ -116,7 +118,7 @@ namespace Units {
         }
 
     private:
-        using Unit<0, 0, 1, false>::Unit;
+        using Unit<0, 0, 1, false, T>::Unit;
     };
 
     namespace UnitsLiterals {
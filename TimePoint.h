@@ -29,44 +29,119 @@
 #ifndef Units_TimePoint_h
 #define Units_TimePoint_h
 
-#include <iostream>
+#include <chrono>
+#include <cstdint>
 #include <thread>
+#include <utility>
+#include "ClockPolicy.h"
+#include "ExactDuration.h"
 #include "Time.h"
 
 namespace Units {
 
+    namespace detail {
+        template <typename P, typename = void>
+        struct ClockOfPolicy {
+            using type = void;
+        };
+
+        template <typename P>
+        struct ClockOfPolicy<P, decltype(void(std::declval<typename P::Clock>()))> {
+            using type = typename P::Clock;
+        };
+
+        /**
+         * Sleeps with the sleep() of the clock policy if it has one (see ClockPolicy::Simulated), or for real time.
+         */
+        template <typename P, typename = void>
+        struct SleepOfPolicy {
+            static void sleep(ExactDuration const &delay) {
+                std::this_thread::sleep_for(delay.toSystemDelay());
+            }
+        };
+
+        template <typename P>
+        struct SleepOfPolicy<P, decltype(P::sleep(std::declval<ExactDuration>()))> {
+            static void sleep(ExactDuration const &delay) {
+                P::sleep(delay);
+            }
+        };
+
+        /**
+         * Sleeps until a point in time with the sleepUntil() of the clock policy if it has one, or for real time until
+         * the clock of the policy reaches it.
+         */
+        template <typename P, typename = void>
+        struct SleepUntilOfPolicy {
+            static constexpr bool isVirtual = false;
+
+            static void sleepUntil(typename P::TimePointType const &t) {
+                for(ExactDuration remaining = P::difference(t, P::now()); remaining > ExactDuration();
+                    remaining = P::difference(t, P::now())) {
+                    std::this_thread::sleep_for(remaining.toSystemDelay());
+                }
+            }
+        };
+
+        template <typename P>
+        struct SleepUntilOfPolicy<P, decltype(P::sleepUntil(std::declval<typename P::TimePointType>()))> {
+            static constexpr bool isVirtual = true;
+
+            static void sleepUntil(typename P::TimePointType const &t) {
+                P::sleepUntil(t);
+            }
+        };
+
+        /**
+         * Tells the processor that the thread is busy-waiting, which saves power and frees resources for the
+         * sibling hyper-thread.
+         */
+        inline void cpuRelax() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            __builtin_ia32_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+            asm volatile("yield");
+#endif
+        }
+    }
+
     /**
      * A convenience function that mimics the <unistd.h> macro usage, but is type safe and allows specification of a
      * precise delay.
+     * The delay is measured by the clock of TimePoint, so that it is virtual with ClockPolicy::Simulated.
      */
     inline void sleep(Duration const &delay) {
-        std::this_thread::sleep_for(delay.toSystemDelay());
+        detail::SleepOfPolicy<ClockPolicy::UNITS_DEFAULT_CLOCK_POLICY>::sleep(ExactDuration::makeFromTime(delay));
     }
 
     /**
-     * Instances of this class represent a particular point in the time.
+     * Instances of this class represent a particular point in the time, read from the clock of the ClockPolicy (see
+     * ClockPolicy.h): std::chrono::high_resolution_clock for TimePoint, steady_clock for SteadyTimePoint, the coarse
+     * monotonic clock of Linux for CoarseTimePoint or the time-stamp counter of x86-64 processors for TscTimePoint.
+     * The points in time are stored in the representation of the clock, and only converted to durations by the
+     * differences.
      */
-    class TimePoint {
+    template <typename ClockPolicy>
+    class BasicTimePoint {
     public:
-        using TimePointClock = std::chrono::high_resolution_clock;
-        using TimePointType = std::chrono::time_point<TimePointClock>;
+        using Policy = ClockPolicy;
+        using TimePointType = typename ClockPolicy::TimePointType;
 
-        TimePoint() : _value(TimePointClock::now()) {}
-        TimePoint(TimePointType d) : _value(d) {}
-        TimePoint(TimePoint const &d) : _value(d.value()) {}
+        /**
+         * The std::chrono clock read by the policy, or void if it is not one.
+         */
+        using TimePointClock = typename detail::ClockOfPolicy<ClockPolicy>::type;
 
-        TimePoint &operator=(TimePoint d) {
-            swap(*this, d);
-            return *this;
-        }
+        BasicTimePoint() : _value(ClockPolicy::now()) {}
+        BasicTimePoint(TimePointType d) : _value(d) {}
 
-        friend void swap(TimePoint &d1, TimePoint &d2) {
+        friend void swap(BasicTimePoint &d1, BasicTimePoint &d2) noexcept {
             using std::swap;
             swap(d1._value, d2._value);
         }
 
-        static TimePoint now() {
-            return TimePoint(TimePointClock::now());
+        static BasicTimePoint now() {
+            return BasicTimePoint(ClockPolicy::now());
         }
 
         /**
@@ -74,8 +149,8 @@ namespace Units {
          * Does not change accross invocations in a same program execution, so that results of two calls of this
          * function will always be positively compared for equality.
          */
-        static TimePoint distantPast() {
-            static TimePointType const distantPast = TimePointClock::now() - std::chrono::hours(24) * 365 * 100;
+        static BasicTimePoint distantPast() {
+            static TimePointType const distantPast = ClockPolicy::advance(ClockPolicy::now(), -distantDelay());
             return distantPast;
         }
 
@@ -84,71 +159,217 @@ namespace Units {
          * Does not change accross invocations in a same program execution, so that results of two calls of this
          * function will always be positively compared for equality.
          */
-        static TimePoint distantFuture() {
-            static TimePointType const distantFuture = TimePointClock::now() + std::chrono::hours(24) * 365 * 100;
+        static BasicTimePoint distantFuture() {
+            static TimePointType const distantFuture = ClockPolicy::advance(ClockPolicy::now(), distantDelay());
             return distantFuture;
         }
 
-        TimePoint &operator-=(Units::Duration const &d);
-        TimePoint &operator+=(Units::Duration const &d);
+        BasicTimePoint &operator-=(Units::Duration const &d) {
+            return *this = *this - d;
+        }
+
+        BasicTimePoint &operator+=(Units::Duration const &d) {
+            return *this = *this + d;
+        }
+
+        BasicTimePoint &operator-=(ExactDuration const &d) {
+            return *this = *this - d;
+        }
+
+        BasicTimePoint &operator+=(ExactDuration const &d) {
+            return *this = *this + d;
+        }
 
         /**
-         * Accesses the underlying std::chrono::time_point.
+         * Accesses the underlying time point of the clock, e.g. a std::chrono::time_point.
          */
         TimePointType value() const {
             return _value;
         }
 
     private:
+        static ExactDuration distantDelay() {
+            return ExactDuration::makeFromSystemDelay(std::chrono::hours(24) * 365 * 100);
+        }
+
         TimePointType _value;
     };
 
-    inline bool operator<(TimePoint const &t1, TimePoint const &t2) {
+    using TimePoint = BasicTimePoint<ClockPolicy::UNITS_DEFAULT_CLOCK_POLICY>;
+    using SteadyTimePoint = BasicTimePoint<ClockPolicy::Steady>;
+#ifdef CLOCK_MONOTONIC_COARSE
+    using CoarseTimePoint = BasicTimePoint<ClockPolicy::CoarseSteady>;
+#endif
+#ifdef UNITS_HAS_TSC_CLOCK
+    using TscTimePoint = BasicTimePoint<ClockPolicy::Tsc>;
+#endif
+
+    template <typename P>
+    bool operator<(BasicTimePoint<P> const &t1, BasicTimePoint<P> const &t2) {
         return t1.value() < t2.value();
     }
 
-    inline bool operator==(TimePoint const &t1, TimePoint const &t2) {
+    template <typename P>
+    bool operator==(BasicTimePoint<P> const &t1, BasicTimePoint<P> const &t2) {
         return t1.value() == t2.value();
     }
 
-    inline bool operator>(TimePoint const &t1, TimePoint const &t2) {
+    template <typename P>
+    bool operator>(BasicTimePoint<P> const &t1, BasicTimePoint<P> const &t2) {
         return t2 < t1;
     }
 
-    inline bool operator!=(TimePoint const &t1, TimePoint const &t2) {
+    template <typename P>
+    bool operator!=(BasicTimePoint<P> const &t1, BasicTimePoint<P> const &t2) {
         return !(t1 == t2);
     }
 
-    inline bool operator<=(TimePoint const &t1, TimePoint const &t2) {
+    template <typename P>
+    bool operator<=(BasicTimePoint<P> const &t1, BasicTimePoint<P> const &t2) {
         return !(t1 > t2);
     }
 
-    inline bool operator>=(TimePoint const &t1, TimePoint const &t2) {
+    template <typename P>
+    bool operator>=(BasicTimePoint<P> const &t1, BasicTimePoint<P> const &t2) {
         return !(t1 < t2);
     }
 
-    inline Units::Duration operator-(TimePoint const &t1, TimePoint const &t2) {
-        auto delta = std::chrono::duration_cast<std::chrono::nanoseconds>(t1.value() - t2.value());
-        return Units::Duration::makeFromNs(delta.count());
+    /**
+     * Returns the exact, integral nanoseconds difference between two time points.
+     */
+    template <typename P>
+    ExactDuration exactDifference(BasicTimePoint<P> const &t1, BasicTimePoint<P> const &t2) {
+        return P::difference(t1.value(), t2.value());
+    }
+
+    template <typename P>
+    Units::Duration operator-(BasicTimePoint<P> const &t1, BasicTimePoint<P> const &t2) {
+        return Units::Duration::makeFromNs(exactDifference(t1, t2).toNs());
+    }
+
+    template <typename P>
+    BasicTimePoint<P> operator-(BasicTimePoint<P> const &t1, Units::Duration const &d2) {
+        return BasicTimePoint<P>{P::advance(t1.value(), -ExactDuration::makeFromSystemDelay(d2.toSystemDelay()))};
     }
 
-    inline TimePoint operator-(TimePoint const &t1, Units::Duration const &d2) {
-        return TimePoint{t1.value() - d2.toSystemDelay()};
+    template <typename P>
+    BasicTimePoint<P> operator+(BasicTimePoint<P> const &t1, Units::Duration const &d2) {
+        return BasicTimePoint<P>{P::advance(t1.value(), ExactDuration::makeFromSystemDelay(d2.toSystemDelay()))};
     }
 
-    inline TimePoint operator+(TimePoint const &t1, Units::Duration const &d2) {
-        return TimePoint{t1.value() + d2.toSystemDelay()};
+    template <typename P>
+    BasicTimePoint<P> operator-(BasicTimePoint<P> const &t1, ExactDuration const &d2) {
+        return BasicTimePoint<P>{P::advance(t1.value(), -d2)};
     }
 
-    inline TimePoint &TimePoint::operator-=(Units::Duration const &d) {
-        *this = *this - d;
-        return *this;
+    template <typename P>
+    BasicTimePoint<P> operator+(BasicTimePoint<P> const &t1, ExactDuration const &d2) {
+        return BasicTimePoint<P>{P::advance(t1.value(), d2)};
     }
 
-    inline TimePoint &TimePoint::operator+=(Units::Duration const &d) {
-        *this = *this + d;
-        return *this;
+    /**
+     * Sleeps until the clock of the time point reaches it, or returns immediately if it is past. Like
+     * std::this_thread::sleep_until, it usually oversleeps by the wake-up latency of the scheduler (see PreciseSleeper).
+     */
+    template <typename P>
+    void sleepUntil(BasicTimePoint<P> const &t) {
+        detail::SleepUntilOfPolicy<P>::sleepUntil(t.value());
     }
+
+    /**
+     * Sleeps until a point in time with an accuracy of about a microsecond: it sleeps until spinSlice() before the
+     * deadline, then busy-waits on the clock with a pause instruction, which costs a core for the duration of the
+     * slice. The slice should be a bit longer than the usual oversleeping of the scheduler, i.e. 50 to 100 us on an
+     * idle Linux machine.
+     * The overshoot of every wake-up, i.e. the delay between the deadline and the return, is counted in statistics.
+     * With a virtual clock (see ClockPolicy::Simulated), it only sleeps with the clock, without busy-waiting.
+     * An instance is meant to be used by one thread at a time.
+     */
+    template <typename ClockPolicy>
+    class BasicPreciseSleeper {
+    public:
+        using TimePointType = BasicTimePoint<ClockPolicy>;
+
+        explicit BasicPreciseSleeper(Duration const &spinSlice = Duration::makeFromUs(200))
+                : _spinSlice(ExactDuration::makeFromTime(spinSlice)) {}
+
+        Duration spinSlice() const {
+            return _spinSlice.toTime();
+        }
+
+        void setSpinSlice(Duration const &spinSlice) {
+            _spinSlice = ExactDuration::makeFromTime(spinSlice);
+        }
+
+        /**
+         * Sleeps until the clock reaches t, or returns immediately if it is past (which does not count as a
+         * wake-up).
+         */
+        void sleepUntil(TimePointType const &t) {
+            if(exactDifference(t, TimePointType::now()) <= ExactDuration()) {
+                return;
+            }
+            if(detail::SleepUntilOfPolicy<ClockPolicy>::isVirtual) {
+                Units::sleepUntil(t);
+            }
+            else {
+                Units::sleepUntil(t - _spinSlice);
+                while(exactDifference(t, TimePointType::now()) > ExactDuration()) {
+                    detail::cpuRelax();
+                }
+            }
+            record(exactDifference(TimePointType::now(), t));
+        }
+
+        /**
+         * Sleeps for the given delay.
+         */
+        void sleep(Duration const &delay) {
+            this->sleepUntil(TimePointType::now() + ExactDuration::makeFromTime(delay));
+        }
+
+        /**
+         * The number of wake-ups counted in the statistics.
+         */
+        std::uint64_t wakeUps() const {
+            return _wakeUps;
+        }
+
+        Duration lastOvershoot() const {
+            return _lastOvershoot.toTime();
+        }
+
+        Duration maxOvershoot() const {
+            return _maxOvershoot.toTime();
+        }
+
+        Duration meanOvershoot() const {
+            return _wakeUps == 0 ? Duration() : (_totalOvershoot / ExactDuration::ValueType(_wakeUps)).toTime();
+        }
+
+        void resetStatistics() {
+            _wakeUps = 0;
+            _lastOvershoot = _maxOvershoot = _totalOvershoot = ExactDuration();
+        }
+
+    private:
+        void record(ExactDuration const &overshoot) {
+            ++_wakeUps;
+            _lastOvershoot = overshoot;
+            _totalOvershoot += overshoot;
+            if(overshoot > _maxOvershoot) {
+                _maxOvershoot = overshoot;
+            }
+        }
+
+        ExactDuration _spinSlice;
+        std::uint64_t _wakeUps = 0;
+        ExactDuration _lastOvershoot;
+        ExactDuration _maxOvershoot;
+        ExactDuration _totalOvershoot;
+    };
+
+    using PreciseSleeper = BasicPreciseSleeper<ClockPolicy::UNITS_DEFAULT_CLOCK_POLICY>;
 }
 
 #endif
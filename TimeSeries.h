@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  TimeSeries.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_TimeSeries_h
+#define Units_TimeSeries_h
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+#include "ExactDuration.h"
+#include "QuantityArray.h"
+#include "QuantitySpan.h"
+#include "Time.h"
+#include "TimePoint.h"
+
+namespace Units {
+
+    /**
+     * A non-owning view over consecutive samples of a BasicTimeSeries, as a span of timestamps and a span of values.
+     * It stays valid until the samples it views are overwritten by later appends.
+     */
+    template <typename Q, typename ClockPolicy>
+    class TimeSeriesWindow {
+    public:
+        using QuantityType = Q;
+        using TimePointType = BasicTimePoint<ClockPolicy>;
+
+        TimeSeriesWindow() = default;
+
+        TimeSeriesWindow(TimePointType const *timestamps, QuantitySpan<Q const> const &values)
+                : _timestamps(timestamps), _values(values) {}
+
+        std::size_t size() const {
+            return _values.size();
+        }
+
+        bool empty() const {
+            return _values.empty();
+        }
+
+        TimePointType timestamp(std::size_t index) const {
+            return _timestamps[index];
+        }
+
+        Q value(std::size_t index) const {
+            return _values[index];
+        }
+
+        /**
+         * The timestamps of the samples, in increasing order.
+         */
+        TimePointType const *timestamps() const {
+            return _timestamps;
+        }
+
+        /**
+         * The values of the samples, e.g. for the kernels of Batch.h.
+         */
+        QuantitySpan<Q const> values() const {
+            return _values;
+        }
+
+    private:
+        TimePointType const *_timestamps = nullptr;
+        QuantitySpan<Q const> _values;
+    };
+
+    /**
+     * A fixed-capacity ring buffer of timestamped samples of a quantity, e.g. the last seconds of a sensor, in
+     * which appending a sample beyond the capacity drops the oldest one.
+     * The timestamps and the values are stored in two separate arrays, the values in a QuantityArray. Each sample is
+     * written twice, at its position in the ring and capacity positions further, so that any range of consecutive
+     * samples is contiguous in both arrays: windows of samples are views, without copy, whatever the position of
+     * the ring.
+     * The samples must be appended in chronological order. They are looked up by time with an interpolation search,
+     * which takes a constant time when the samples are about evenly spaced, and a logarithmic time in the worst case.
+     *
+     * @param Q the type of the sampled quantity (Speed, Length…).
+     */
+    template <typename Q, typename ClockPolicy>
+    class BasicTimeSeries {
+    public:
+        using QuantityType = Q;
+        using TimePointType = BasicTimePoint<ClockPolicy>;
+        using WindowType = TimeSeriesWindow<Q, ClockPolicy>;
+
+        /**
+         * Creates an empty series holding up to capacity samples, which must be positive.
+         */
+        explicit BasicTimeSeries(std::size_t capacity)
+                : _capacity(capacity),
+                  _timestamps(2 * capacity, TimePointType(typename ClockPolicy::TimePointType())),
+                  _values(2 * capacity) {
+            assert(capacity > 0);
+        }
+
+        std::size_t capacity() const {
+            return _capacity;
+        }
+
+        std::size_t size() const {
+            return _size;
+        }
+
+        bool empty() const {
+            return _size == 0;
+        }
+
+        void clear() {
+            _start = _size = 0;
+        }
+
+        /**
+         * Appends a sample, timestamped no earlier than the last one, dropping the oldest sample if the series is
+         * full.
+         */
+        void append(TimePointType const &t, Q const &value) {
+            assert(this->empty() || !(t < this->timestamp(_size - 1)));
+            std::size_t position = _start + _size;
+            if(_size == _capacity) {
+                if(++_start == _capacity) {
+                    _start = 0;
+                }
+            }
+            else {
+                ++_size;
+            }
+            if(position >= _capacity) {
+                position -= _capacity;
+            }
+            _timestamps[position] = _timestamps[position + _capacity] = t;
+            _values.set(position, value);
+            _values.set(position + _capacity, value);
+        }
+
+        /**
+         * Returns the timestamp of the index-th sample, from the oldest.
+         */
+        TimePointType timestamp(std::size_t index) const {
+            assert(index < _size);
+            return _timestamps[_start + index];
+        }
+
+        /**
+         * Returns the value of the index-th sample, from the oldest.
+         */
+        Q value(std::size_t index) const {
+            assert(index < _size);
+            return _values[_start + index];
+        }
+
+        /**
+         * Returns the index of the first sample timestamped at t or later, or size() if there is none.
+         */
+        std::size_t lowerBound(TimePointType const &t) const {
+            TimePointType const *timestamps = _timestamps.data() + _start;
+            std::size_t const n = _size;
+            if(n == 0 || !(timestamps[0] < t)) {
+                return 0;
+            }
+            if(timestamps[n - 1] < t) {
+                return n;
+            }
+
+            // timestamps[0] < t <= timestamps[n - 1]: guesses the position of t from the average sampling period,
+            // then brackets it by steps doubling from the guess, and bisects the bracket.
+            long double const span = exactDifference(timestamps[n - 1], timestamps[0]).toNs();
+            long double const offset = exactDifference(t, timestamps[0]).toNs();
+            std::size_t guess = std::size_t(offset / span * (n - 1));
+            guess = std::min(std::max(guess, std::size_t(1)), n - 1);
+
+            std::size_t low, high, step = 1;
+            if(timestamps[guess] < t) {
+                low = guess;
+                while(low + step < n - 1 && timestamps[low + step] < t) {
+                    low += step;
+                    step *= 2;
+                }
+                high = std::min(low + step, n - 1);
+            }
+            else {
+                high = guess;
+                while(high > step && !(timestamps[high - step] < t)) {
+                    high -= step;
+                    step *= 2;
+                }
+                low = high > step ? high - step : 0;
+            }
+            return std::size_t(std::lower_bound(timestamps + low + 1, timestamps + high, t) - timestamps);
+        }
+
+        /**
+         * Returns the value at t, linearly interpolated between the samples around it, or the value of the first
+         * (last) sample if t is before (after) it. The series must not be empty.
+         */
+        Q interpolate(TimePointType const &t) const {
+            assert(!this->empty());
+            std::size_t const index = this->lowerBound(t);
+            if(index == 0) {
+                return this->value(0);
+            }
+            if(index == _size) {
+                return this->value(_size - 1);
+            }
+            using ValueType = typename Q::ValueType;
+            TimePointType const t0 = this->timestamp(index - 1), t1 = this->timestamp(index);
+            ValueType const v0 = this->value(index - 1).toValue(), v1 = this->value(index).toValue();
+            double const ratio = double(exactDifference(t, t0).toNs()) / double(exactDifference(t1, t0).toNs());
+            return Q::makeFromValue(ValueType(v0 + (v1 - v0) * ratio));
+        }
+
+        /**
+         * Returns a view over all the samples.
+         */
+        WindowType all() const {
+            return this->slice(0, _size);
+        }
+
+        /**
+         * Returns a view over the samples timestamped from begin included to end excluded.
+         */
+        WindowType window(TimePointType const &begin, TimePointType const &end) const {
+            std::size_t const first = this->lowerBound(begin);
+            return this->slice(first, std::max(first, this->lowerBound(end)));
+        }
+
+        /**
+         * Returns a view over the samples timestamped within the given duration before the last one, included.
+         */
+        WindowType last(Duration const &duration) const {
+            if(this->empty()) {
+                return WindowType();
+            }
+            return this->slice(this->lowerBound(this->timestamp(_size - 1) - ExactDuration::makeFromTime(duration)), _size);
+        }
+
+    private:
+        WindowType slice(std::size_t first, std::size_t end) const {
+            return WindowType(_timestamps.data() + _start + first, _values.span().subspan(_start + first, end - first));
+        }
+
+        std::size_t _capacity;
+        std::size_t _start = 0;
+        std::size_t _size = 0;
+        std::vector<TimePointType> _timestamps;
+        QuantityArray<Q> _values;
+    };
+
+    template <typename Q>
+    using TimeSeries = BasicTimeSeries<Q, ClockPolicy::UNITS_DEFAULT_CLOCK_POLICY>;
+}
+
+#endif
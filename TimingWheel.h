@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  TimingWheel.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_TimingWheel_h
+#define Units_TimingWheel_h
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "Bits.h"
+#include "ExactDuration.h"
+#include "Time.h"
+#include "TimePoint.h"
+
+namespace Units {
+
+    /**
+     * Identifies a timer of a BasicTimingWheel, to cancel it. A default-constructed id identifies no timer.
+     */
+    struct TimerId {
+        std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+        std::uint32_t generation = 0;
+    };
+
+    /**
+     * A hierarchical timing wheel, holding many timers (e.g. per-connection timeouts), each carrying a value of type
+     * T, with O(1) schedule() and cancel().
+     * The time is divided in ticks of a configurable granularity, counted from the creation of the wheel. The timers
+     * expiring within the next 64 ticks are in the 64 slots of the first level, one per tick; the next level has 64
+     * slots of 64 ticks each, and so on, each timer being moved down one level at a time as its deadline gets closer.
+     * advance() moves the wheel to the current time, jumping from one occupied slot to the next with the occupancy
+     * bitmaps of the levels, so that its cost does not depend on the length of the empty stretches, and hands the
+     * timers expiring at each tick to a function in a single batch. Timers never expire before their deadline, but up
+     * to one tick after it.
+     * The timers are stored in a pool which grows with the number of pending timers, and reuses the slots of the
+     * expired and cancelled ones. T must be default-constructible and movable.
+     */
+    template <typename T, typename ClockPolicy>
+    class BasicTimingWheel {
+    public:
+        using TimePointType = BasicTimePoint<ClockPolicy>;
+
+        /**
+         * Creates an empty wheel whose first tick starts now.
+         */
+        explicit BasicTimingWheel(Duration const &granularity = Duration::makeFromMs(1),
+                                  TimePointType const &origin = TimePointType::now())
+                : _granularity(ExactDuration::makeFromTime(granularity)), _origin(origin) {
+            assert(_granularity > ExactDuration());
+            for(auto &level : _slots) {
+                level.fill(none);
+            }
+            _occupied.fill(0);
+        }
+
+        Duration granularity() const {
+            return _granularity.toTime();
+        }
+
+        /**
+         * The start of the last tick the wheel advanced to.
+         */
+        TimePointType now() const {
+            return this->timeOf(_tick);
+        }
+
+        /**
+         * The number of pending timers.
+         */
+        std::size_t size() const {
+            return _size;
+        }
+
+        bool empty() const {
+            return _size == 0;
+        }
+
+        /**
+         * Schedules a timer expiring at the given deadline, or at the next tick if it is past.
+         */
+        TimerId schedule(TimePointType const &deadline, T value) {
+            ExactDuration const fromOrigin = exactDifference(deadline, _origin);
+            std::uint64_t tick = _tick + 1;
+            if(fromOrigin > ExactDuration()) {
+                std::uint64_t const ticks = std::uint64_t((fromOrigin.toNs() - 1) / _granularity.toNs()) + 1;
+                tick = ticks > tick ? ticks : tick;
+            }
+
+            std::uint32_t index;
+            if(_free != none) {
+                index = _free;
+                _free = _nodes[index].next;
+            }
+            else {
+                assert(_nodes.size() < none);
+                index = std::uint32_t(_nodes.size());
+                _nodes.emplace_back();
+            }
+            Node &node = _nodes[index];
+            node.value = std::move(value);
+            node.expiry = tick;
+            this->link(index);
+            ++_size;
+            return TimerId{index, node.generation};
+        }
+
+        /**
+         * Schedules a timer expiring after the given delay from the current time of the clock.
+         */
+        TimerId schedule(Duration const &delay, T value) {
+            return this->schedule(TimePointType::now() + ExactDuration::makeFromTime(delay), std::move(value));
+        }
+
+        /**
+         * Cancels a pending timer. Returns false if the timer is already expired or cancelled.
+         */
+        bool cancel(TimerId const &id) {
+            if(!this->isPending(id)) {
+                return false;
+            }
+            this->unlink(id.index);
+            this->release(id.index);
+            --_size;
+            return true;
+        }
+
+        bool isPending(TimerId const &id) const {
+            return id.index < _nodes.size() && _nodes[id.index].generation == id.generation &&
+                   _nodes[id.index].slot != freeSlot;
+        }
+
+        /**
+         * Moves the wheel to the tick containing the given time, and calls expire(tick, batch) once for each tick
+         * with expiring timers, tick being the start of the tick and batch a std::vector<T> holding the values of its
+         * timers. expire may schedule or cancel other timers. Returns the number of expired timers.
+         */
+        template <typename F>
+        std::size_t advance(TimePointType const &time, F &&expire) {
+            ExactDuration const fromOrigin = exactDifference(time, _origin);
+            if(fromOrigin < ExactDuration()) {
+                return 0;
+            }
+            std::uint64_t const target = std::uint64_t(fromOrigin.toNs() / _granularity.toNs());
+            std::size_t expired = 0;
+            while(_tick < target) {
+                if(_size == 0) {
+                    _tick = target;
+                    break;
+                }
+                // Jumps straight to the next occupied slot, in the lowest level holding timers, whose timers are first
+                // moved down the wheel if it is an upper level.
+                int level = 0;
+                std::uint64_t const next = this->nextOccupied(level);
+                if(next > target) {
+                    _tick = target;
+                    break;
+                }
+                _tick = next;
+                if(level > 0) {
+                    this->cascade();
+                }
+                expired += this->expireTick(expire);
+            }
+            return expired;
+        }
+
+        /**
+         * Moves the wheel to the current time of the clock.
+         */
+        template <typename F>
+        std::size_t advance(F &&expire) {
+            return this->advance(TimePointType::now(), std::forward<F>(expire));
+        }
+
+    private:
+        static constexpr int levelBits = 6;
+        static constexpr std::size_t slotCount = std::size_t(1) << levelBits;
+        static constexpr int levelCount = (64 + levelBits - 1) / levelBits;
+        static constexpr std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+        static constexpr std::uint16_t freeSlot = std::numeric_limits<std::uint16_t>::max();
+
+        struct Node {
+            T value{};
+            std::uint64_t expiry = 0;
+            std::uint32_t previous = none;
+            std::uint32_t next = none;
+            std::uint32_t generation = 0;
+            std::uint16_t slot = freeSlot;
+        };
+
+        TimePointType timeOf(std::uint64_t tick) const {
+            return _origin + _granularity * ExactDuration::ValueType(tick);
+        }
+
+        /**
+         * Links a node to the slot of its expiry: the first level if it expires in the current rotation of the
+         * first level, the second if it expires in the current rotation of the second, etc.
+         */
+        void link(std::uint32_t index) {
+            Node &node = _nodes[index];
+            std::uint64_t const differentBits = (node.expiry ^ _tick) | (slotCount - 1);
+            int const level = detail::mostSignificantBit(differentBits) / levelBits;
+            std::size_t const slot = std::size_t(node.expiry >> (level * levelBits)) & (slotCount - 1);
+            node.slot = std::uint16_t(level * slotCount + slot);
+            node.previous = none;
+            node.next = _slots[level][slot];
+            if(node.next != none) {
+                _nodes[node.next].previous = index;
+            }
+            _slots[level][slot] = index;
+            _occupied[level] |= std::uint64_t(1) << slot;
+        }
+
+        void unlink(std::uint32_t index) {
+            Node &node = _nodes[index];
+            std::size_t const level = node.slot / slotCount, slot = node.slot % slotCount;
+            if(node.previous != none) {
+                _nodes[node.previous].next = node.next;
+            }
+            else {
+                _slots[level][slot] = node.next;
+                if(node.next == none) {
+                    _occupied[level] &= ~(std::uint64_t(1) << slot);
+                }
+            }
+            if(node.next != none) {
+                _nodes[node.next].previous = node.previous;
+            }
+        }
+
+        void release(std::uint32_t index) {
+            Node &node = _nodes[index];
+            node.value = T();
+            node.slot = freeSlot;
+            ++node.generation;
+            node.next = _free;
+            _free = index;
+        }
+
+        /**
+         * Returns the start of the first occupied slot after the current tick, in the lowest level holding timers, and
+         * sets level to this level. The slots of the upper levels all start after the end of the current rotation of
+         * the levels below them, so that no earlier slot of another level can hold timers. There must be pending
+         * timers.
+         */
+        std::uint64_t nextOccupied(int &level) const {
+            for(level = 0; level < levelCount; ++level) {
+                int const shift = level * levelBits;
+                std::size_t const current = std::size_t(_tick >> shift) & (slotCount - 1);
+                std::uint64_t const remaining = _occupied[level] & (~std::uint64_t(0) << current << 1);
+                if(remaining != 0) {
+                    std::uint64_t const rotation =
+                        shift + levelBits < 64 ? _tick & ~((std::uint64_t(1) << (shift + levelBits)) - 1) : 0;
+                    return rotation + (std::uint64_t(detail::leastSignificantBit(remaining)) << shift);
+                }
+            }
+            assert(false);
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+
+        /**
+         * Moves the timers of the slots of the upper levels which start at the current tick down the wheel.
+         */
+        void cascade() {
+            int top = 1;
+            while(top < levelCount && ((_tick >> (top * levelBits)) & (slotCount - 1)) == 0) {
+                ++top;
+            }
+            for(int level = top < levelCount ? top : levelCount - 1; level >= 1; --level) {
+                std::size_t const slot = std::size_t(_tick >> (level * levelBits)) & (slotCount - 1);
+                std::uint32_t index = _slots[level][slot];
+                _slots[level][slot] = none;
+                _occupied[level] &= ~(std::uint64_t(1) << slot);
+                while(index != none) {
+                    std::uint32_t const next = _nodes[index].next;
+                    this->link(index);
+                    index = next;
+                }
+            }
+        }
+
+        /**
+         * Expires the timers of the current tick, in one batch.
+         */
+        template <typename F>
+        std::size_t expireTick(F &expire) {
+            std::size_t const slot = std::size_t(_tick) & (slotCount - 1);
+            std::uint32_t index = _slots[0][slot];
+            if(index == none) {
+                return 0;
+            }
+            _slots[0][slot] = none;
+            _occupied[0] &= ~(std::uint64_t(1) << slot);
+            _batch.clear();
+            while(index != none) {
+                std::uint32_t const next = _nodes[index].next;
+                _batch.push_back(std::move(_nodes[index].value));
+                this->release(index);
+                index = next;
+            }
+            _size -= _batch.size();
+            std::size_t const expired = _batch.size();
+            expire(this->timeOf(_tick), _batch);
+            return expired;
+        }
+
+        ExactDuration _granularity;
+        TimePointType _origin;
+        std::uint64_t _tick = 0;
+        std::size_t _size = 0;
+        std::vector<Node> _nodes;
+        std::uint32_t _free = none;
+        std::array<std::array<std::uint32_t, slotCount>, levelCount> _slots;
+        std::array<std::uint64_t, levelCount> _occupied;
+        std::vector<T> _batch;
+    };
+
+    template <typename T>
+    using TimingWheel = BasicTimingWheel<T, ClockPolicy::UNITS_DEFAULT_CLOCK_POLICY>;
+}
+
+#endif
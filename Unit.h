@@ -31,13 +31,11 @@
 
 #include <cmath>
 #include <limits>
+#include <type_traits>
 
 #include <iosfwd>
 
-#ifndef UNITS_NO_OVERFLOW_CHECK
-#include <iostream>
-#endif
-
+#include "OverflowPolicy.h"
 #include "math.h"
 
 namespace Units {
@@ -53,24 +51,38 @@ namespace Units {
     template <typename T>
     constexpr bool is_unit_v = is_unit<T>::value;
 
-    template <int Kg, int M, int S, bool Specialized>
+    template <int Kg, int M, int S, bool Specialized, typename T = UnitBase::ValueType>
     class Unit : public UnitBase {};
 
+    /**
+     * The representation of the result of an arithmetic operation between two quantities (or a quantity and a
+     * scalar) whose representations are T1 and T2. It follows the usual arithmetic conversions, the same way
+     * std::chrono::duration does (e.g. float and double gives double, int and float gives float).
+     */
+    template <typename T1, typename T2>
+    using CommonValueType = std::common_type_t<T1, T2>;
+
     /**
      * This class is meant to represent a physical quantity in a type-safe manner.
      * It is the base class of a hierarchy of specialized types.
+     * The copy and the assignment are the implicit ones, so that every quantity type is trivially copyable, like its
+     * value: it is passed in registers, and containers of quantities are copied with memcpy.
      *
      * @param Kg the integral power of the kilogrammes component.
      * @param M the integral power of the metres component.
      * @param S the integral power of the seconds component.
+     * @param T the arithmetic type used to store the numerical value of the quantity (float, double, int32_t…).
      */
-    template <int Kg, int M, int S>
-    class Unit<Kg, M, S, false> : public UnitBase {
-        template <int Kg1, int M1, int S1>
-        using DerivedType = Unit<Kg1, M1, S1, true>;
+    template <int Kg, int M, int S, typename T>
+    class Unit<Kg, M, S, false, T> : public UnitBase {
+        template <int Kg1, int M1, int S1, typename T1 = T>
+        using DerivedType = Unit<Kg1, M1, S1, true, T1>;
+
+        template <int, int, int, bool, typename>
+        friend class Unit;
 
     public:
-        using ValueType = UnitBase::ValueType;
+        using ValueType = T;
 
         /**
          * Create a physical quantity from a raw numerical value.
@@ -84,26 +96,27 @@ namespace Units {
         }
 
         /**
-         * Returns the maximal value (i.e. the magnitude) of the quantity. Depends only on the underlying type.
+         * Returns the raw numerical value stored in the quantity, i.e. the counterpart of makeFromValue(). It is
+         * expressed in the unit used internally for the dimension (metres for a length, turns for an angle…).
          */
-        static constexpr DerivedType<Kg, M, S> max() {
-            return DerivedType<Kg, M, S>(std::numeric_limits<ValueType>::max());
+        constexpr ValueType toValue() const {
+            return _val;
         }
 
         /**
-         * Swaps the value of two instances of the physical quantity.
+         * Returns the maximal value (i.e. the magnitude) of the quantity. Depends only on the underlying type.
          */
-        constexpr friend void swap(DerivedType<Kg, M, S> &v1, DerivedType<Kg, M, S> const &v2) {
-            using std::swap;
-            swap(v1._val, v2._val);
+        static constexpr DerivedType<Kg, M, S> max() {
+            return DerivedType<Kg, M, S>(std::numeric_limits<ValueType>::max());
         }
 
         /**
-         * Assignment operator.
+         * Returns a copy of the quantity, stored with another representation.
+         * E.g. (1_m).toRep<float>() returns a length of 1 metre stored as a float.
          */
-        constexpr DerivedType<Kg, M, S> &operator=(DerivedType<Kg, M, S> v) {
-            std::swap(static_cast<DerivedType<Kg, M, S> &>(*this), v);
-            return static_cast<DerivedType<Kg, M, S> &>(*this);
+        template <typename U, typename Policy = OverflowPolicy::Default>
+        constexpr DerivedType<Kg, M, S, U> toRep() const {
+            return DerivedType<Kg, M, S, U>::makeFromValue(value<U, Policy>());
         }
 
         /**
@@ -129,12 +142,6 @@ namespace Units {
             _val += val._val;
             return static_cast<DerivedType<Kg, M, S> &>(*this);
         }
-        /**
-         * Adds two same-dimension instances of physical quantity and returns the result as a new instance.
-         */
-        constexpr friend DerivedType<Kg, M, S> operator+(DerivedType<Kg, M, S> const &v1, DerivedType<Kg, M, S> const &v2) {
-            return makeFromValue(v1._val + v2._val);
-        }
 
         /**
          * Substracts the parameter, a quantity of same dimension, to the current instance.
@@ -144,13 +151,6 @@ namespace Units {
             return static_cast<DerivedType<Kg, M, S> &>(*this);
         }
 
-        /**
-         * Returns the difference of two physical quantities as a new instance.
-         */
-        constexpr friend DerivedType<Kg, M, S> operator-(DerivedType<Kg, M, S> const &v1, DerivedType<Kg, M, S> const &v2) {
-            return makeFromValue(v1._val - v2._val);
-        }
-
         /**
          * Multiplies the current instance by the parameter.
          * The parameter is a scalar value.
@@ -161,48 +161,15 @@ namespace Units {
             return static_cast<DerivedType<Kg, M, S> &>(*this);
         }
 
-        /**
-         * Multiplies the two instance together.
-         * The 2nd parameter is a scalar value.
-         */
-        template <typename U, int Kg1, int M1, int S1>
-        constexpr friend std::enable_if_t<std::is_scalar<U>::value, Unit<Kg1, M1, S1, true>>
-            operator*(Unit<Kg1, M1, S1, true> const &v1, U const &v2);
-
-
-        /**
-         * Multiplies the two instance together.
-         * The 1st parameter is a scalar value.
-         */
-        template <typename U, int Kg1, int M1, int S1>
-        constexpr friend Unit<Kg1, M1, S1, true> operator*(U const &v1, Unit<Kg1, M1, S1, true> const &v2);
-
         /**
          * Divides *this by the argument.
          * The parameter is a scalar value.
          */
         template <typename U>
-        constexpr std::enable_if_t<std::is_arithmetic<U>::value, DerivedType<Kg, M, S> &> operator/=(DerivedType<Kg, M, S> val) {
+        constexpr std::enable_if_t<std::is_arithmetic<U>::value, DerivedType<Kg, M, S> &> operator/=(U val) {
             _val /= val;
             return static_cast<DerivedType<Kg, M, S> &>(*this);
         }
-        /**
-         * Returns a physical quantity divided by a scalar.
-         */
-        template <typename U>
-        constexpr friend std::enable_if_t<std::is_arithmetic<U>::value, DerivedType<Kg, M, S>>
-            operator/(DerivedType<Kg, M, S> const &v1, U v2) {
-            return makeFromValue(v1._val / v2);
-        }
-
-        /**
-         * Returns a scalar divided by a physical quantity.
-         */
-        template <typename U>
-        constexpr friend std::enable_if_t<std::is_arithmetic<U>::value, DerivedType<-Kg, -M, -S>>
-            operator/(U v1, DerivedType<Kg, M, S> const &v2) {
-            return DerivedType<-Kg, -M, -S>::makeFromValue(v1 / v2.value());
-        }
 
         /**
          * Sets the value of the quantity to the remainder of the division of the instance by the parameter.
@@ -214,113 +181,6 @@ namespace Units {
             return static_cast<DerivedType<Kg, M, S> &>(*this);
         }
 
-        /**
-         * Returns the remainder of the division of the two parameters. E.g., 14_m % 4 returns 2_m, as 14_m - 4 * 3_m =
-         * 2_m.
-         * @param v1 The dividend of the division.
-         * @param v2 The divisor of the division.
-         * @return The remainder f the division.
-         */
-        constexpr friend DerivedType<Kg, M, S> operator%(DerivedType<Kg, M, S> const &v1, DerivedType<Kg, M, S> v2) {
-            return makeFromValue(std::fmod(v1._val, v2._val));
-        }
-
-        /**
-         * Tests for strict equality between the values.
-         * Be careful that if the underlying type is floating point, a comparison with a delta may be better suitable.
-         */
-        constexpr friend bool operator==(DerivedType<Kg, M, S> const &val1, DerivedType<Kg, M, S> const &val2) {
-            return val1._val == val2._val;
-        }
-
-        /**
-         * Tests for strict inequality between the values.
-         * Be careful that if the underlying type is floating point, a comparison with a delta may be better suitable.
-         */
-        constexpr friend bool operator!=(DerivedType<Kg, M, S> const &val1, DerivedType<Kg, M, S> const &val2) {
-            return !(val1 == val2);
-        }
-
-        /**
-         * Compares two physical quantities.
-         */
-        constexpr friend bool operator<(DerivedType<Kg, M, S> const &val1, DerivedType<Kg, M, S> const &val2) {
-            return val1._val < val2._val;
-        }
-
-        /**
-         * Compares two physical quantities.
-         */
-        constexpr friend bool operator>(DerivedType<Kg, M, S> const &val1, DerivedType<Kg, M, S> const &val2) {
-            return val2._val < val1._val;
-        }
-
-        /**
-         * Compares two physical quantities.
-         */
-        constexpr friend bool operator<=(DerivedType<Kg, M, S> const &val1, DerivedType<Kg, M, S> const &val2) {
-            return !(val1._val > val2._val);
-        }
-
-        /**
-         * Compares two physical quantities.
-         */
-        constexpr friend bool operator>=(DerivedType<Kg, M, S> const &val1, DerivedType<Kg, M, S> const &val2) {
-            return !(val1._val < val2._val);
-        }
-
-        /**
-         * Returns the absolute value (magnitude) of the quantity.
-         */
-        constexpr friend DerivedType<Kg, M, S> abs(DerivedType<Kg, M, S> const &val) {
-            return val >= DerivedType<Kg, M, S>() ? val : -val;
-        }
-
-        /**
-         * Returns the cosine of the quantity.
-         */
-        constexpr friend ValueType cos(DerivedType<Kg, M, S> const &val) {
-            using std::cos;
-            return cos(val._val * 2 * M_PI);
-        }
-        /**
-         * Returns the cosine of the quantity.
-         */
-        constexpr friend ValueType cos_constexpr(DerivedType<Kg, M, S> const &val) {
-            return cos_constexpr(val._val * 2 * M_PI);
-        }
-        /**
-         * Returns the sine of the quantity.
-         */
-        constexpr friend ValueType sin(DerivedType<Kg, M, S> const &val) {
-            using std::sin;
-            return sin(val._val * 2 * M_PI);
-        }
-        /**
-         * Returns the sine of the quantity.
-         */
-        constexpr friend ValueType sin_constexpr(DerivedType<Kg, M, S> const &val) {
-            return sin_constexpr(val._val * 2 * M_PI);
-        }
-
-        /**
-         * Returns the product of a physical quantity with another physical quantity.
-         * The return type is coherent (e.g.: speed * time => length).
-         */
-        template <int Kg1, int M1, int S1, int Kg2, int M2, int S2>
-        friend constexpr Unit<Kg1 + Kg2, M1 + M2, S1 + S2, true>
-            operator*(Unit<Kg1, M1, S1, true> const &t1, Unit<Kg2, M2, S2, true> const &t2);
-        /**
-         * Returns the division of a physical quantity by another physical quantity.
-         * The return type is coherent (e.g.: time / speed => length).
-         */
-        template <int Kg1, int M1, int S1, int Kg2, int M2, int S2>
-        friend constexpr Unit<Kg1 - Kg2, M1 - M2, S1 - S2, true>
-            operator/(Unit<Kg1, M1, S1, true> const &t1, Unit<Kg2, M2, S2, true> const &t2);
-
-        template <int Kg1, int M1, int S1>
-        friend constexpr UnitBase::ValueType operator/(Unit<Kg1, M1, S1, true> const &t1, Unit<Kg1, M1, S1, true> const &t2);
-
     protected:
         /**
          * Value constructor.
@@ -331,64 +191,293 @@ namespace Units {
          * Default constructor, the numeric value of the quantity is value-initialized.
          */
         constexpr Unit() : _val(ValueType()) {}
-        /**
-         * Copy constructor.
-         */
-        Unit(DerivedType<Kg, M, S> const &v) : _val(v._val) {}
 
         /**
          * Gives access to the dimensionless numerical value of the instance.
          * It is to be used by the child classes (e.g. the Length class uses this method for the return value of its
          * toM() method.)
-         * It allows for casting the value to any arithmetic type, and optionally printing a warning in case of
-         * overflow, depending if the preprocessor define UNITS_NO_OVERFLOW_CHECK is set or not.
+         * It allows for casting the value to any arithmetic type, the values out of the range of that type being handled
+         * by the overflow policy (see OverflowPolicy.h).
          */
-        template <typename U = ValueType>
+        template <typename U = ValueType, typename Policy = OverflowPolicy::Default>
         constexpr U value() const {
-#ifndef UNITS_NO_OVERFLOW_CHECK
-            if(_val > std::numeric_limits<U>::max() || _val < std::numeric_limits<U>::lowest()) {
-                std::cerr << "The physical quantity's magnitude can not be represented with the requested data type, "
-                             "an incoherent value will be generated." << std::endl;
-            }
-#endif // UNITS_NO_OVERFLOW_CHECK
-            return static_cast<U>(_val);
+            using Selected = std::conditional_t<std::is_same<Policy, OverflowPolicy::Default>::value,
+                                                OverflowPolicyOf_t<DerivedType<Kg, M, S>>, Policy>;
+            return Selected::template convert<U>(_val);
         }
 
         ValueType _val;
     };
 
-    template <typename U, int Kg1, int M1, int S1>
-    constexpr std::enable_if_t<std::is_scalar<U>::value, Unit<Kg1, M1, S1, true>>
-        operator*(Unit<Kg1, M1, S1, true> const &v1, U const &v2) {
-        return Unit<Kg1, M1, S1, true>::makeFromValue(v1.value() * v2);
+    /**
+     * The operators of Unit are function templates of the namespace rather than friends declared in the class, so
+     * that each of them is declared once, instead of once per instantiated dimension. They only use its public
+     * interface.
+     */
+
+    /**
+     * Multiplies the two instance together.
+     * The 2nd parameter is a scalar value.
+     */
+    template <typename U, int Kg1, int M1, int S1, typename T1>
+    constexpr std::enable_if_t<std::is_scalar<U>::value, Unit<Kg1, M1, S1, true, CommonValueType<T1, U>>>
+        operator*(Unit<Kg1, M1, S1, true, T1> const &v1, U const &v2) {
+        return Unit<Kg1, M1, S1, true, CommonValueType<T1, U>>::makeFromValue(v1.toValue() * v2);
     }
 
-    template <typename U, int Kg1, int M1, int S1>
-    constexpr Unit<Kg1, M1, S1, true> operator*(U const &v1, Unit<Kg1, M1, S1, true> const &v2) {
+    /**
+     * Multiplies the two instance together.
+     * The 1st parameter is a scalar value.
+     */
+    template <typename U, int Kg1, int M1, int S1, typename T1>
+    constexpr std::enable_if_t<std::is_scalar<U>::value, Unit<Kg1, M1, S1, true, CommonValueType<T1, U>>>
+        operator*(U const &v1, Unit<Kg1, M1, S1, true, T1> const &v2) {
         return v2 * v1;
     }
 
-    template <int Kg, int M, int S>
-    class Unit<Kg, M, S, true> : public Unit<Kg, M, S, false> {
-        friend class Unit<Kg, M, S, false>;
-        using Unit<Kg, M, S, false>::Unit;
+    template <int Kg, int M, int S, typename T>
+    class Unit<Kg, M, S, true, T> : public Unit<Kg, M, S, false, T> {
+        friend class Unit<Kg, M, S, false, T>;
+        using Unit<Kg, M, S, false, T>::Unit;
     };
 
-    template <int Kg1, int M1, int S1, int Kg2, int M2, int S2>
-    constexpr Unit<Kg1 + Kg2, M1 + M2, S1 + S2, true>
-        operator*(Unit<Kg1, M1, S1, true> const &t1, Unit<Kg2, M2, S2, true> const &t2) {
-        return Unit<Kg1 + Kg2, M1 + M2, S1 + S2, true>::makeFromValue(t1.value() * t2.value());
+    /**
+     * Adds two same-dimension instances of physical quantity and returns the result as a new instance.
+     */
+    template <int Kg, int M, int S, typename T>
+    constexpr Unit<Kg, M, S, true, T> operator+(Unit<Kg, M, S, true, T> const &v1, Unit<Kg, M, S, true, T> const &v2) {
+        return Unit<Kg, M, S, true, T>::makeFromValue(v1.toValue() + v2.toValue());
     }
 
-    template <int Kg1, int M1, int S1, int Kg2, int M2, int S2>
-    constexpr Unit<Kg1 - Kg2, M1 - M2, S1 - S2, true>
-        operator/(Unit<Kg1, M1, S1, true> const &t1, Unit<Kg2, M2, S2, true> const &t2) {
-        return Unit<Kg1 - Kg2, M1 - M2, S1 - S2, true>::makeFromValue(t1.value() / t2.value());
+    /**
+     * Returns the difference of two physical quantities as a new instance.
+     */
+    template <int Kg, int M, int S, typename T>
+    constexpr Unit<Kg, M, S, true, T> operator-(Unit<Kg, M, S, true, T> const &v1, Unit<Kg, M, S, true, T> const &v2) {
+        return Unit<Kg, M, S, true, T>::makeFromValue(v1.toValue() - v2.toValue());
+    }
+
+    /**
+     * Returns a physical quantity divided by a scalar.
+     */
+    template <typename U, int Kg, int M, int S, typename T>
+    constexpr std::enable_if_t<std::is_arithmetic<U>::value, Unit<Kg, M, S, true, CommonValueType<T, U>>>
+        operator/(Unit<Kg, M, S, true, T> const &v1, U v2) {
+        return Unit<Kg, M, S, true, CommonValueType<T, U>>::makeFromValue(v1.toValue() / v2);
+    }
+
+    /**
+     * Returns a scalar divided by a physical quantity.
+     */
+    template <typename U, int Kg, int M, int S, typename T>
+    constexpr std::enable_if_t<std::is_arithmetic<U>::value, Unit<-Kg, -M, -S, true, CommonValueType<T, U>>>
+        operator/(U v1, Unit<Kg, M, S, true, T> const &v2) {
+        return Unit<-Kg, -M, -S, true, CommonValueType<T, U>>::makeFromValue(v1 / v2.toValue());
+    }
+
+    /**
+     * Returns the remainder of the division of the two parameters. E.g., 14_m % 4 returns 2_m, as 14_m - 4 * 3_m =
+     * 2_m.
+     * @param v1 The dividend of the division.
+     * @param v2 The divisor of the division.
+     * @return The remainder f the division.
+     */
+    template <int Kg, int M, int S, typename T>
+    constexpr Unit<Kg, M, S, true, T> operator%(Unit<Kg, M, S, true, T> const &v1, Unit<Kg, M, S, true, T> const &v2) {
+        return Unit<Kg, M, S, true, T>::makeFromValue(std::fmod(v1.toValue(), v2.toValue()));
+    }
+
+    /**
+     * Tests for strict equality between the values.
+     * Be careful that if the underlying type is floating point, a comparison with a delta may be better suitable.
+     */
+    template <int Kg, int M, int S, typename T>
+    constexpr bool operator==(Unit<Kg, M, S, true, T> const &val1, Unit<Kg, M, S, true, T> const &val2) {
+        return val1.toValue() == val2.toValue();
+    }
+
+    /**
+     * Tests for strict inequality between the values.
+     * Be careful that if the underlying type is floating point, a comparison with a delta may be better suitable.
+     */
+    template <int Kg, int M, int S, typename T>
+    constexpr bool operator!=(Unit<Kg, M, S, true, T> const &val1, Unit<Kg, M, S, true, T> const &val2) {
+        return !(val1 == val2);
+    }
+
+    /**
+     * Compares two physical quantities.
+     */
+    template <int Kg, int M, int S, typename T>
+    constexpr bool operator<(Unit<Kg, M, S, true, T> const &val1, Unit<Kg, M, S, true, T> const &val2) {
+        return val1.toValue() < val2.toValue();
+    }
+
+    /**
+     * Compares two physical quantities.
+     */
+    template <int Kg, int M, int S, typename T>
+    constexpr bool operator>(Unit<Kg, M, S, true, T> const &val1, Unit<Kg, M, S, true, T> const &val2) {
+        return val2.toValue() < val1.toValue();
+    }
+
+    /**
+     * Compares two physical quantities.
+     */
+    template <int Kg, int M, int S, typename T>
+    constexpr bool operator<=(Unit<Kg, M, S, true, T> const &val1, Unit<Kg, M, S, true, T> const &val2) {
+        return !(val1.toValue() > val2.toValue());
+    }
+
+    /**
+     * Compares two physical quantities.
+     */
+    template <int Kg, int M, int S, typename T>
+    constexpr bool operator>=(Unit<Kg, M, S, true, T> const &val1, Unit<Kg, M, S, true, T> const &val2) {
+        return !(val1.toValue() < val2.toValue());
+    }
+
+    /**
+     * Swaps the value of two instances of the physical quantity.
+     */
+    template <int Kg, int M, int S, typename T>
+    void swap(Unit<Kg, M, S, true, T> &v1, Unit<Kg, M, S, true, T> &v2) noexcept {
+        Unit<Kg, M, S, true, T> const v = v1;
+        v1 = v2;
+        v2 = v;
+    }
+
+    /**
+     * Returns the absolute value (magnitude) of the quantity.
+     */
+    template <int Kg, int M, int S, typename T>
+    constexpr Unit<Kg, M, S, true, T> abs(Unit<Kg, M, S, true, T> const &val) {
+        return val >= Unit<Kg, M, S, true, T>() ? val : -val;
+    }
+
+    /**
+     * Returns the product of a physical quantity with another physical quantity.
+     * The return type is coherent (e.g.: speed * time => length).
+     */
+    template <int Kg1, int M1, int S1, typename T1, int Kg2, int M2, int S2, typename T2>
+    constexpr Unit<Kg1 + Kg2, M1 + M2, S1 + S2, true, CommonValueType<T1, T2>>
+        operator*(Unit<Kg1, M1, S1, true, T1> const &t1, Unit<Kg2, M2, S2, true, T2> const &t2) {
+        return Unit<Kg1 + Kg2, M1 + M2, S1 + S2, true, CommonValueType<T1, T2>>::makeFromValue(t1.toValue() * t2.toValue());
     }
 
-    template <int Kg1, int M1, int S1>
-    constexpr UnitBase::ValueType operator/(Unit<Kg1, M1, S1, true> const &t1, Unit<Kg1, M1, S1, true> const &t2) {
-        return t1.value() / t2.value();
+    /**
+     * Returns the division of a physical quantity by another physical quantity.
+     * The return type is coherent (e.g.: time / speed => length).
+     */
+    template <int Kg1, int M1, int S1, typename T1, int Kg2, int M2, int S2, typename T2>
+    constexpr Unit<Kg1 - Kg2, M1 - M2, S1 - S2, true, CommonValueType<T1, T2>>
+        operator/(Unit<Kg1, M1, S1, true, T1> const &t1, Unit<Kg2, M2, S2, true, T2> const &t2) {
+        return Unit<Kg1 - Kg2, M1 - M2, S1 - S2, true, CommonValueType<T1, T2>>::makeFromValue(t1.toValue() / t2.toValue());
+    }
+
+    /**
+     * Returns the ratio of two physical quantities of same dimension, which is a scalar.
+     */
+    template <int Kg1, int M1, int S1, typename T1, typename T2>
+    constexpr CommonValueType<T1, T2> operator/(Unit<Kg1, M1, S1, true, T1> const &t1, Unit<Kg1, M1, S1, true, T2> const &t2) {
+        return t1.toValue() / t2.toValue();
+    }
+
+    /**
+     * Returns the cosine of a dimensionless quantity, i.e. an angle.
+     */
+    template <typename T>
+    constexpr T cos(Unit<0, 0, 0, true, T> const &val) {
+        using std::cos;
+        return cos(val.toValue() * 2 * M_PI);
+    }
+
+    /**
+     * Returns the cosine of a dimensionless quantity, i.e. an angle, in a constant expression.
+     */
+    template <typename T>
+    constexpr T cos_constexpr(Unit<0, 0, 0, true, T> const &val) {
+        return cosTurns(val.toValue());
+    }
+
+    /**
+     * Returns the sine of a dimensionless quantity, i.e. an angle.
+     */
+    template <typename T>
+    constexpr T sin(Unit<0, 0, 0, true, T> const &val) {
+        using std::sin;
+        return sin(val.toValue() * 2 * M_PI);
+    }
+
+    /**
+     * Returns the sine of a dimensionless quantity, i.e. an angle, in a constant expression.
+     */
+    template <typename T>
+    constexpr T sin_constexpr(Unit<0, 0, 0, true, T> const &val) {
+        return sinTurns(val.toValue());
+    }
+
+    /**
+     * Mixed-representation overloads of the additive and comparison operators. Both operands are converted to their
+     * common representation before the operation (e.g. a float length plus a double length gives a double length).
+     * Operations between two quantities of the same representation use the namespace-scope operator templates above.
+     */
+    template <int Kg, int M, int S, typename T1, typename T2>
+    using MixedRepType = std::enable_if_t<!std::is_same<T1, T2>::value, Unit<Kg, M, S, true, CommonValueType<T1, T2>>>;
+
+    template <int Kg, int M, int S, typename T1, typename T2>
+    constexpr MixedRepType<Kg, M, S, T1, T2> operator+(Unit<Kg, M, S, true, T1> const &v1, Unit<Kg, M, S, true, T2> const &v2) {
+        return v1.template toRep<CommonValueType<T1, T2>>() + v2.template toRep<CommonValueType<T1, T2>>();
+    }
+
+    template <int Kg, int M, int S, typename T1, typename T2>
+    constexpr MixedRepType<Kg, M, S, T1, T2> operator-(Unit<Kg, M, S, true, T1> const &v1, Unit<Kg, M, S, true, T2> const &v2) {
+        return v1.template toRep<CommonValueType<T1, T2>>() - v2.template toRep<CommonValueType<T1, T2>>();
+    }
+
+    template <int Kg, int M, int S, typename T1, typename T2>
+    constexpr std::enable_if_t<!std::is_same<T1, T2>::value, bool> operator==(Unit<Kg, M, S, true, T1> const &v1,
+                                                                              Unit<Kg, M, S, true, T2> const &v2) {
+        return v1.template toRep<CommonValueType<T1, T2>>() == v2.template toRep<CommonValueType<T1, T2>>();
+    }
+
+    template <int Kg, int M, int S, typename T1, typename T2>
+    constexpr std::enable_if_t<!std::is_same<T1, T2>::value, bool> operator!=(Unit<Kg, M, S, true, T1> const &v1,
+                                                                              Unit<Kg, M, S, true, T2> const &v2) {
+        return !(v1 == v2);
+    }
+
+    template <int Kg, int M, int S, typename T1, typename T2>
+    constexpr std::enable_if_t<!std::is_same<T1, T2>::value, bool> operator<(Unit<Kg, M, S, true, T1> const &v1,
+                                                                             Unit<Kg, M, S, true, T2> const &v2) {
+        return v1.template toRep<CommonValueType<T1, T2>>() < v2.template toRep<CommonValueType<T1, T2>>();
+    }
+
+    template <int Kg, int M, int S, typename T1, typename T2>
+    constexpr std::enable_if_t<!std::is_same<T1, T2>::value, bool> operator>(Unit<Kg, M, S, true, T1> const &v1,
+                                                                             Unit<Kg, M, S, true, T2> const &v2) {
+        return v2 < v1;
+    }
+
+    template <int Kg, int M, int S, typename T1, typename T2>
+    constexpr std::enable_if_t<!std::is_same<T1, T2>::value, bool> operator<=(Unit<Kg, M, S, true, T1> const &v1,
+                                                                              Unit<Kg, M, S, true, T2> const &v2) {
+        return !(v2 < v1);
+    }
+
+    template <int Kg, int M, int S, typename T1, typename T2>
+    constexpr std::enable_if_t<!std::is_same<T1, T2>::value, bool> operator>=(Unit<Kg, M, S, true, T1> const &v1,
+                                                                              Unit<Kg, M, S, true, T2> const &v2) {
+        return !(v1 < v2);
+    }
+
+    /**
+     * Prints a quantity stored with a non-default representation, by converting it to the default one first.
+     */
+    template <int Kg, int M, int S, typename T>
+    std::enable_if_t<!std::is_same<T, UnitBase::ValueType>::value, std::ostream &>
+        operator<<(std::ostream &s, Unit<Kg, M, S, true, T> const &v) {
+        return s << v.template toRep<UnitBase::ValueType>();
     }
 }
 
@@ -27,7 +27,7 @@
 //
 
 #include "Units.h"
-#include <iostream>
+#include <ostream>
 
 #ifdef UNITS_HEADER_ONLY
 #define UNITS_CONDIIONAL_INLINE inline
@@ -88,6 +88,10 @@ namespace Units {
         return s;
     }
 
+    UNITS_CONDIIONAL_INLINE std::ostream &operator<<(std::ostream &s, ExactDuration const &d) {
+        return s << d.toTime();
+    }
+
     UNITS_CONDIIONAL_INLINE std::ostream &operator<<(std::ostream &s, Angle const &v) {
         return s << v._val;
     }
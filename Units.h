@@ -32,9 +32,11 @@
 #include "Unit.h"
 
 #include "Angle.h"
+#include "BinaryAngle.h"
 #include "Length.h"
 #include "Surface.h"
 #include "Time.h"
+#include "ExactDuration.h"
 #include "Mass.h"
 #include "Speed.h"
 #include "Frequency.h"
@@ -44,17 +46,19 @@ namespace Units {
     /**
      * Returns the angle of the vector (x, y).
      */
-    inline Angle atan2(Length const &y, Length const &x) {
+    template <typename T>
+    inline BasicAngle<T> atan2(BasicLength<T> const &y, BasicLength<T> const &x) {
         using std::atan2;
-        return Angle::makeFromRad(atan2(y.toM(), x.toM()));
+        return BasicAngle<T>::makeFromRad(atan2(y.toM(), x.toM()));
     }
 
     /**
      * Returs the square root of a surface/area, i.e. the edge length of a square of this surface.
      */
-    inline Length sqrt(Surface const &s) {
+    template <typename T>
+    inline BasicLength<T> sqrt(BasicSurface<T> const &s) {
         using std::sqrt;
-        return Length::makeFromM(sqrt(s.toM2()));
+        return BasicLength<T>::makeFromM(sqrt(s.toM2()));
     }
 }
 
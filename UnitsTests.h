@@ -32,6 +32,8 @@
 
 /**
  * Define UNITS_TESTS this before including the "Units.h" to run basic compile-time unit tests (no pun intended).
+ * The run-time tests of the batch operations, of CsvReader and of ClockPolicy::Simulated are in BatchTests.h,
+ * CsvReaderTests.h and SimulatedClockTests.h.
  */
 #ifdef UNITS_TESTS
 
@@ -39,11 +41,17 @@ namespace Units {
     namespace UnitsTests {
         using namespace UnitsLiterals;
 
-        static_assert(sin_constexpr(1_PI) < 1e-15, "");
-        static_assert(cos_constexpr(0.5_PI) < 1e-15, "");
+        static_assert(sin_constexpr(1_PI) == 0, "");
+        static_assert(cos_constexpr(0.5_PI) == 0, "");
 
-        static_assert(sin_constexpr(0.5_PI) > (1 - 1e-15), "");
-        static_assert(cos_constexpr(1_PI) < -(1 - 1e-15), "");
+        static_assert(sin_constexpr(0.5_PI) == 1, "");
+        static_assert(cos_constexpr(1_PI) == -1, "");
+
+        static_assert(sin_constexpr(M_PI / 6) > 0.5 - 1e-15 && sin_constexpr(M_PI / 6) < 0.5 + 1e-15, "");
+        static_assert(cos_constexpr(-M_PI / 3) > 0.5 - 1e-15 && cos_constexpr(-M_PI / 3) < 0.5 + 1e-15, "");
+        static_assert(sin_constexpr(1e6) > -0.349993503 && sin_constexpr(1e6) < -0.349993502, "");
+        static_assert(sinTurns(1e15 + 0.25) == 1, "");
+        static_assert(sinTurns(1.0f / 12) > 0.5f - 1e-7f && sinTurns(1.0f / 12) < 0.5f + 1e-7f, "");
 
         static_assert(1 / 1_s == 1_Hz, "");
         static_assert(1 / (2 * M_PI) / 1_s == 1_rad_s, "");
@@ -60,6 +68,52 @@ namespace Units {
 
         static_assert((1_km).toM() - 1000 < 1e-15, "");
         static_assert((1_cm).toMm() - 10 < 1e-15, "");
+
+        static_assert(std::is_same<decltype(BasicSpeed<float>::makeFromM_s(1) * BasicTime<float>::makeFromS(1)),
+                                   BasicLength<float>>::value,
+                      "");
+        static_assert(std::is_same<decltype(BasicLength<float>::makeFromM(1) + 1_m), Length>::value, "");
+        static_assert(std::is_same<decltype(BasicLength<int>::makeFromM(1) * 0.5), Length>::value, "");
+        static_assert(BasicLength<float>::makeFromM(2) + 2_m == 4_m, "");
+        static_assert((1_m).toRep<float>().toMm() == 1000.0f, "");
+        static_assert((1_km).toMm<std::int32_t>() == 1000000, "");
+        static_assert((1e4_km).toMm<std::int32_t, OverflowPolicy::Saturate>() == std::numeric_limits<std::int32_t>::max(), "");
+        static_assert((-1_m).toMm<std::uint16_t, OverflowPolicy::Saturate>() == 0, "");
+        static_assert((1_km).toMm<std::int32_t, OverflowPolicy::Trap>() == 1000000, "");
+
+        // A quantity is nothing more than its value: same size, alignment and arithmetic as the raw representation.
+        static_assert(sizeof(Length) == sizeof(double) && alignof(Length) == alignof(double), "");
+        static_assert(sizeof(BasicSpeed<float>) == sizeof(float) && alignof(BasicSpeed<float>) == alignof(float), "");
+        static_assert(sizeof(BasicTime<std::int64_t>) == sizeof(std::int64_t), "");
+        static_assert(sizeof(Unit<1, -2, 3, true>) == sizeof(double), "");
+        static_assert(sizeof(Length[7]) == sizeof(double[7]), "");
+        static_assert(std::is_standard_layout<Length>::value && std::is_standard_layout<BasicAngle<float>>::value, "");
+        static_assert(std::is_trivially_copyable<Length>::value && std::is_trivially_copyable<BasicAngle<float>>::value, "");
+        static_assert(std::is_trivially_copyable<Unit<1, -2, 3, true, std::int32_t>>::value, "");
+        static_assert(std::is_trivially_copyable<ExactDuration>::value && std::is_trivially_copyable<BinaryAngle>::value, "");
+        static_assert(std::is_standard_layout<ExactDuration>::value && std::is_standard_layout<BinaryAngle>::value, "");
+        static_assert(std::is_nothrow_move_constructible<Speed>::value && std::is_nothrow_move_assignable<Speed>::value, "");
+        static_assert(std::is_nothrow_copy_assignable<Time>::value && noexcept(swap(std::declval<Time &>(), std::declval<Time &>())), "");
+        static_assert((1.5_m + 2.25_m_s * 0.1_s).toValue() == 1.5 + 2.25 * 0.1, "");
+        static_assert((0.1_m * 0.2_m + 0.3_m * 0.4_m).toValue() == 0.1 * 0.2 + 0.3 * 0.4, "");
+        static_assert(Length::makeFromM(0.123).toMm() == 0.123 * 1000, "");
+
+        static_assert(ExactDuration::makeFromS(1) - ExactDuration::makeFromNs(1) == ExactDuration::makeFromNs(999999999), "");
+        static_assert(ExactDuration::makeFromS(1LL << 32).toSystemDelay().count() == (1LL << 32) * 1000000000, "");
+        static_assert(ExactDuration::makeFromTime(1.5_ms) == ExactDuration::makeFromUs(1500), "");
+        static_assert(ExactDuration::makeFromSystemDelay(std::chrono::hours(1)) == ExactDuration::makeFromS(3600), "");
+        static_assert(ExactDuration::makeFromTime(Time::makeFromS(1e12)).toNs() == std::numeric_limits<std::int64_t>::max(), "");
+        static_assert(ExactDuration::makeFromTime(Time::makeFromS(-1e12)).toNs() == std::numeric_limits<std::int64_t>::min(), "");
+        static_assert(ExactDuration::makeFromMs(3) * 2u / 4 == ExactDuration::makeFromUs(1500), "");
+
+        static_assert(BinaryAngle::makeFromAngle(0.5_PI).toValue() == 0x40000000, "");
+        static_assert(BinaryAngle::makeFromAngle(-0.5_PI).toValue() == 0xC0000000, "");
+        static_assert(BinaryAngle::makeFromAngle(7_PI) == BinaryAngle::makeFromAngle(-1_PI), "");
+        static_assert(BinaryAngle64::makeFromAngle(-1_PI).toSignedValue() == std::numeric_limits<std::int64_t>::min(), "");
+        static_assert(BinaryAngle::makeFromAngle(1.5_PI) + BinaryAngle::makeFromAngle(1_PI) == BinaryAngle::makeFromAngle(0.5_PI), "");
+        static_assert(BinaryAngle::makeFromAngle(1.5_PI).toMod2Pi() == 1.5_PI, "");
+        static_assert(BinaryAngle::makeFromAngle(1.5_PI).toMinusPiPi() == -0.5_PI, "");
+        static_assert(cos(BinaryAngle::makeFromAngle(1_PI)) == -1, "");
     }
 }
 
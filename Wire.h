@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2015 Rémi Saurel
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+//  Wire.h
+//
+//  Created by Rémi on 17/10/2026.
+//
+
+#ifndef Units_Wire_h
+#define Units_Wire_h
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#include "QuantitySpan.h"
+#include "Unit.h"
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ || defined(_M_IX86) || defined(_M_X64) || \
+    defined(_M_ARM64)
+#define UNITS_LITTLE_ENDIAN
+#endif
+
+namespace Units {
+
+    /**
+     * The result of encode(), with the same members as std::to_chars_result: ptr is one past the last written byte on
+     * success, and last with ec == std::errc::value_too_large if the buffer is too small.
+     */
+    struct EncodeResult {
+        char *ptr;
+        std::errc ec;
+    };
+
+    /**
+     * The result of decode(), with the same members as std::from_chars_result: ptr is one past the last read byte on
+     * success, and first on failure, with ec == std::errc::invalid_argument if the data holds another type of quantity,
+     * or std::errc::message_size if it is truncated.
+     */
+    struct DecodeResult {
+        char const *ptr;
+        std::errc ec;
+    };
+
+    namespace detail {
+        /**
+         * The code of a representation in a wire tag: its kind in the high nibble (1 for IEEE 754 floating point, 2 for
+         * signed and 3 for unsigned integers) and the base-2 logarithm of its size in bytes in the low one.
+         */
+        template <typename T>
+        constexpr std::uint32_t wireRepresentation() {
+            static_assert(std::is_integral<T>::value ||
+                              (std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8)),
+                          "Only integers and 32 or 64-bit IEEE 754 floating-point values have a fixed-width encoding.");
+            static_assert(sizeof(T) <= 8, "Values larger than 64 bits have no fixed-width encoding.");
+            return (std::is_floating_point<T>::value ? 0x10u : std::is_signed<T>::value ? 0x20u : 0x30u) |
+                   (sizeof(T) == 1 ? 0u : sizeof(T) == 2 ? 1u : sizeof(T) == 4 ? 2u : 3u);
+        }
+
+        template <int Exponent>
+        constexpr std::uint32_t wireExponent() {
+            static_assert(Exponent >= -128 && Exponent <= 127, "The dimension exponents are encoded on 8 bits.");
+            return std::uint32_t(std::uint8_t(std::int8_t(Exponent)));
+        }
+
+        /**
+         * Flag of the representation byte telling a span of values from a single value.
+         */
+        constexpr std::uint32_t wireArrayFlag = 0x80u << 24;
+
+        template <typename Q>
+        struct WireTraits;
+
+        template <int Kg, int M, int S, typename T>
+        struct WireTraits<Unit<Kg, M, S, true, T>> {
+            using ValueType = T;
+
+            static constexpr std::uint32_t tag = wireExponent<Kg>() | wireExponent<M>() << 8 | wireExponent<S>() << 16 |
+                                                 wireRepresentation<T>() << 24;
+        };
+
+        template <typename T>
+        using WireBits = std::conditional_t<sizeof(T) == 1, std::uint8_t,
+                                            std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                                                               std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+        /**
+         * Copies count values from src to the little-endian bytes at dst, with a single memcpy on little-endian hosts.
+         */
+        template <typename T>
+        void storeLittleEndian(char *dst, T const *src, std::size_t count) {
+#ifdef UNITS_LITTLE_ENDIAN
+            std::memcpy(dst, src, count * sizeof(T));
+#else
+            for(std::size_t i = 0; i < count; ++i) {
+                WireBits<T> bits;
+                std::memcpy(&bits, src + i, sizeof(T));
+                for(std::size_t b = 0; b < sizeof(T); ++b) {
+                    dst[i * sizeof(T) + b] = char(std::uint8_t(bits >> (8 * b)));
+                }
+            }
+#endif
+        }
+
+        template <typename T>
+        void loadLittleEndian(T *dst, char const *src, std::size_t count) {
+#ifdef UNITS_LITTLE_ENDIAN
+            std::memcpy(dst, src, count * sizeof(T));
+#else
+            for(std::size_t i = 0; i < count; ++i) {
+                WireBits<T> bits = 0;
+                for(std::size_t b = 0; b < sizeof(T); ++b) {
+                    bits |= WireBits<T>(std::uint8_t(src[i * sizeof(T) + b])) << (8 * b);
+                }
+                std::memcpy(dst + i, &bits, sizeof(T));
+            }
+#endif
+        }
+
+        /**
+         * Reads the header of an encoded span of quantities of type Q, and checks that its values fit in [first, last[.
+         */
+        template <typename Q>
+        DecodeResult decodeSpanHeader(char const *first, char const *last, std::uint64_t &count) {
+            constexpr std::size_t headerSize = 16;
+            if(std::size_t(last - first) < headerSize) {
+                return DecodeResult{first, std::errc::message_size};
+            }
+            std::uint32_t tag;
+            loadLittleEndian(&tag, first, 1);
+            if(tag != (WireTraits<Q>::tag | wireArrayFlag)) {
+                return DecodeResult{first, std::errc::invalid_argument};
+            }
+            loadLittleEndian(&count, first + 8, 1);
+            if((std::size_t(last - first) - headerSize) / sizeof(typename Q::ValueType) < count) {
+                return DecodeResult{first, std::errc::message_size};
+            }
+            return DecodeResult{first + headerSize, std::errc()};
+        }
+    }
+
+    /**
+     * The tag identifying the type of quantity Q in the wire encoding: its three dimension exponents and the code of its
+     * representation, one byte each (from the least significant byte: Kg, M, S, representation). The tag is a
+     * compile-time constant, so that checking it takes a single integer comparison.
+     */
+    template <typename Q>
+    constexpr std::uint32_t wireTag() {
+        return detail::WireTraits<Q>::tag;
+    }
+
+    /**
+     * The size in bytes of an encoded quantity of type Q: its 4-byte tag followed by its value.
+     */
+    template <typename Q>
+    constexpr std::size_t wireSize() {
+        return 4 + sizeof(typename detail::WireTraits<Q>::ValueType);
+    }
+
+    /**
+     * The size in bytes of the header of an encoded span: the tag of its type, 4 reserved bytes, and the number of
+     * values on 8 bytes. The values follow the header, and are thus aligned if the buffer is aligned on 8 bytes.
+     */
+    constexpr std::size_t wireSpanHeaderSize = 16;
+
+    /**
+     * The size in bytes of an encoded span of count quantities of type Q.
+     */
+    template <typename Q>
+    constexpr std::size_t wireSize(std::size_t count) {
+        return wireSpanHeaderSize + count * sizeof(typename detail::WireTraits<Q>::ValueType);
+    }
+
+    /**
+     * Writes a quantity into the buffer [first, last[ with a fixed-width little-endian encoding: the wireTag() of its
+     * type followed by its raw value, wireSize<Q>() bytes in total.
+     */
+    template <int Kg, int M, int S, typename T>
+    EncodeResult encode(char *first, char *last, Unit<Kg, M, S, true, T> const &q) {
+        using Q = Unit<Kg, M, S, true, T>;
+        if(std::size_t(last - first) < wireSize<Q>()) {
+            return EncodeResult{last, std::errc::value_too_large};
+        }
+        std::uint32_t const tag = wireTag<Q>();
+        T const value = q.toValue();
+        detail::storeLittleEndian(first, &tag, 1);
+        detail::storeLittleEndian(first + 4, &value, 1);
+        return EncodeResult{first + wireSize<Q>(), std::errc()};
+    }
+
+    /**
+     * Writes a span of quantities into the buffer [first, last[: a header of wireSpanHeaderSize bytes holding the tag
+     * of their type and their number, followed by their raw values, wireSize<Q>(values.size()) bytes in total.
+     */
+    template <typename Q>
+    EncodeResult encode(char *first, char *last, QuantitySpan<Q> const &values) {
+        using Plain = std::remove_const_t<Q>;
+        using T = typename Plain::ValueType;
+        if(std::size_t(last - first) < wireSpanHeaderSize ||
+           (std::size_t(last - first) - wireSpanHeaderSize) / sizeof(T) < values.size()) {
+            return EncodeResult{last, std::errc::value_too_large};
+        }
+        std::uint32_t const header[2] = {wireTag<Plain>() | detail::wireArrayFlag, 0};
+        std::uint64_t const count = values.size();
+        detail::storeLittleEndian(first, header, 2);
+        detail::storeLittleEndian(first + 8, &count, 1);
+        detail::storeLittleEndian(first + wireSpanHeaderSize, values.data(), values.size());
+        return EncodeResult{first + wireSize<Plain>(values.size()), std::errc()};
+    }
+
+    /**
+     * Reads a quantity written by encode() from the buffer [first, last[. The tag must be the one of the type of q,
+     * e.g. a Speed cannot be decoded as a Length, nor a float length as a double one.
+     */
+    template <int Kg, int M, int S, typename T>
+    DecodeResult decode(char const *first, char const *last, Unit<Kg, M, S, true, T> &q) {
+        using Q = Unit<Kg, M, S, true, T>;
+        if(std::size_t(last - first) < wireSize<Q>()) {
+            return DecodeResult{first, std::errc::message_size};
+        }
+        std::uint32_t tag;
+        detail::loadLittleEndian(&tag, first, 1);
+        if(tag != wireTag<Q>()) {
+            return DecodeResult{first, std::errc::invalid_argument};
+        }
+        T value;
+        detail::loadLittleEndian(&value, first + 4, 1);
+        q = Q::makeFromValue(value);
+        return DecodeResult{first + wireSize<Q>(), std::errc()};
+    }
+
+    /**
+     * Reads a span of quantities written by encode() from the buffer [first, last[, without copying them: on success,
+     * values views the raw values inside the buffer, which must outlive it.
+     * The values can only be viewed in place on little-endian hosts, and if they are suitably aligned, i.e. if the
+     * encoded span starts on an 8-byte boundary; otherwise std::errc::not_supported is returned and the values must be
+     * read with the overload taking a mutable span.
+     */
+    template <typename Q>
+    DecodeResult decode(char const *first, char const *last, QuantitySpan<Q const> &values) {
+        using T = typename Q::ValueType;
+        std::uint64_t count;
+        DecodeResult const header = detail::decodeSpanHeader<Q>(first, last, count);
+        if(header.ec != std::errc()) {
+            return header;
+        }
+#ifdef UNITS_LITTLE_ENDIAN
+        if(reinterpret_cast<std::uintptr_t>(header.ptr) % alignof(T) != 0) {
+            return DecodeResult{first, std::errc::not_supported};
+        }
+        values = QuantitySpan<Q const>(reinterpret_cast<T const *>(header.ptr), std::size_t(count));
+        return DecodeResult{header.ptr + count * sizeof(T), std::errc()};
+#else
+        return DecodeResult{first, std::errc::not_supported};
+#endif
+    }
+
+    /**
+     * Reads a span of quantities written by encode() from the buffer [first, last[ into values, which must hold at
+     * least as many quantities as the encoded span; values is then narrowed to the decoded ones. Returns
+     * std::errc::value_too_large if values is too small.
+     */
+    template <typename Q>
+    std::enable_if_t<!std::is_const<Q>::value, DecodeResult> decode(char const *first, char const *last, QuantitySpan<Q> &values) {
+        using T = typename Q::ValueType;
+        std::uint64_t count;
+        DecodeResult const header = detail::decodeSpanHeader<Q>(first, last, count);
+        if(header.ec != std::errc()) {
+            return header;
+        }
+        if(count > values.size()) {
+            return DecodeResult{first, std::errc::value_too_large};
+        }
+        detail::loadLittleEndian(values.data(), header.ptr, std::size_t(count));
+        values = values.subspan(0, std::size_t(count));
+        return DecodeResult{header.ptr + count * sizeof(T), std::errc()};
+    }
+}
+
+#endif
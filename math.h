@@ -31,28 +31,142 @@
 #define Units_Math_h
 
 #include <cmath>
+#include <limits>
+
+/**
+ * Whether the enclosing constexpr function is being evaluated in a constant expression. Compilers without
+ * __builtin_is_constant_evaluated (before GCC 9 and Clang 9) always take the constant-expression path.
+ */
+#ifdef __has_builtin
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define UNITS_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#ifndef UNITS_IS_CONSTANT_EVALUATED
+#define UNITS_IS_CONSTANT_EVALUATED() true
+#endif
 
 namespace Units {
+    namespace detail {
+        /**
+         * Rounds v to the nearest integer (ties to even) by adding and subtracting 2^(digits - 1) with the sign of v,
+         * values larger than that in magnitude being already integers. Infinities and NaN are left unchanged.
+         * Branch-free, so that V can be either the scalar type T or a GCC vector of T (hence the output parameter, as
+         * returning a vector by value would depend on the instruction set). Requires strict IEEE arithmetic (no
+         * -ffast-math).
+         */
+        template <typename T, typename V>
+        constexpr void roundToIntegral(V const &v, V &result) {
+            constexpr T integral = T(1) / std::numeric_limits<T>::epsilon();
+            // Conditional operators on single comparisons, as combining comparison masks is not vectorized well.
+            V const magnitude = v < T(0) ? -v : v;
+            V const rounding = v < T(0) ? V{} - integral : V{} + integral;
+            result = magnitude < integral ? (v + rounding) - rounding : v;
+        }
+
+        template <typename T>
+        constexpr T roundToIntegral(T const v) {
+            T result{};
+            roundToIntegral<T>(v, result);
+            return result;
+        }
+
+        /**
+         * Computes the sine and the cosine of an angle x expressed in turns (1 turn = 2π rad), the internal unit of
+         * Angle. The range reduction is exact: x is reduced to [-1/2, 1/2] turn and then to [-1/8, 1/8] turn by
+         * subtracting the nearest integer and quarter turns, which involves no rounding error for any finite x. The
+         * reduced angle then goes through the Taylor polynomials of sin(2πr) and cos(2πr), of degrees 17/16 for double
+         * and 9/10 for float.
+         * Measured against a long double reference on 2.10^7 random arguments, the error is below 1.5 ulp for double
+         * and 2 ulp for float (taking the ulp of 0.5 as the unit around the zeros of the functions).
+         * The computation is branch-free and only uses arithmetic operators, comparisons and conditional operators, so
+         * that V can be either the scalar type T or a GCC vector of T. The nearest integers are given by
+         * roundToIntegral(), which requires strict IEEE arithmetic (no -ffast-math).
+         * The results are the same for the scalar and every vector type as long as the polynomials are not contracted
+         * into FMA instructions. Clang is kept from it by a pragma, but GCC contracts them wherever FMA instructions
+         * are enabled, i.e. in the AVX-512 kernels of Batch.h and everywhere with e.g. -march=haswell or -march=native:
+         * with GCC, build with -ffp-contract=off for bit-identical results. UnitsTests::checkBatch() checks them.
+         */
+        template <typename T, typename V>
+        constexpr void sincosTurns(V const &x, V &s, V &c) {
+#ifdef __clang__
+#pragma clang fp contract(off)
+#endif
+            constexpr int terms = std::numeric_limits<T>::digits > 24 ? 9 : 5;
+
+            T const sinCoefficients[] = {T(6.283185307179586),   T(-41.34170224039976), T(81.60524927607506),
+                                         T(-76.70585975306139),  T(42.058693944897655), T(-15.09464257682299),
+                                         T(3.819952584848282),   T(-0.7181223017785006), T(0.10422916220813984)};
+            T const cosCoefficients[] = {T(1.0),                 T(-19.739208802178716), T(64.9393940226683),
+                                         T(-85.45681720669373),  T(60.24464137187666),   T(-26.4262567833744),
+                                         T(7.903536371318469),   T(-1.714390711088672),  T(0.28200596845579123)};
+
+            // Infinities and NaN give a NaN.
+            V n{}, k{};
+            roundToIntegral<T>(x, n);
+            V const f = x - n;
+            roundToIntegral<T>(f * 4, k);
+            V const r = f - k * T(0.25);
+            V const r2 = r * r;
+
+            V ps = r2 * sinCoefficients[terms - 1] + sinCoefficients[terms - 2];
+            V pc = r2 * cosCoefficients[terms - 1] + cosCoefficients[terms - 2];
+            for(int i = terms - 3; i >= 0; --i) {
+                ps = ps * r2 + sinCoefficients[i];
+                pc = pc * r2 + cosCoefficients[i];
+            }
+            ps = ps * r;
+
+            s = k == T(0) ? ps : (k == T(1) ? pc : (k == T(-1) ? -pc : -ps));
+            c = k == T(0) ? pc : (k == T(1) ? -ps : (k == T(-1) ? ps : -pc));
+        }
+    }
+
     /**
-     * These functions provide compile-time sine and cosine values with a relative error (compared to the std::sin/cos
-     * results) less than 1e-10 in magnitude (tested for a subset of values, no warranty is given for the whole
-     * range ]-∞, +∞[ !).
+     * Returns the sine of x, expressed in turns. At run time, it is slower than std::sin (about 1.4 times for double
+     * and 2 times for float at -O2 on x86-64), but its range reduction is exact and its results are those of
+     * Batch::sincos().
+     */
+    template <typename T>
+    constexpr T sinTurns(T const x) {
+        T s{}, c{};
+        detail::sincosTurns<T>(x, s, c);
+        return s;
+    }
+
+    /**
+     * Returns the cosine of x, expressed in turns.
+     */
+    template <typename T>
+    constexpr T cosTurns(T const x) {
+        T s{}, c{};
+        detail::sincosTurns<T>(x, s, c);
+        return c;
+    }
+
+    /**
+     * These functions provide compile-time sine and cosine values of x, expressed in radians. At run time, they call
+     * std::sin and std::cos, which are faster and more accurate (see UNITS_IS_CONSTANT_EVALUATED).
+     * In constant expressions, x is first converted to turns, which costs a rounding error relative to x: the absolute
+     * error is below 2 * |x| * epsilon, in addition to the error of detail::sincosTurns(). The overloads taking an Angle
+     * use its stored turns directly, without this conversion (e.g. sin_constexpr(1_PI) is exactly 0).
      */
     template <typename T>
     constexpr T sin_constexpr(T const x) {
-        if(x < 0) {
-            return sin_constexpr(M_PI - x);
-        }
-        if(x < 1e-6) {
-            return x;
+        if(UNITS_IS_CONSTANT_EVALUATED()) {
+            return sinTurns<T>(x * T(0.15915494309189533576888376337251436));
         }
-        auto toCube = sin_constexpr(x / 3.0);
-        return 3 * sin_constexpr(x / 3.0) - 4 * toCube * toCube * toCube;
+        using std::sin;
+        return sin(x);
     }
 
     template <typename T>
     constexpr T cos_constexpr(T const x) {
-        return sin_constexpr(M_PI / 2 - x);
+        if(UNITS_IS_CONSTANT_EVALUATED()) {
+            return cosTurns<T>(x * T(0.15915494309189533576888376337251436));
+        }
+        using std::cos;
+        return cos(x);
     }
 }
 